@@ -0,0 +1,100 @@
+import struct
+
+import pytest
+
+from viz.parsing import find_runs_with_overview, get_best_solution_id, load_overview, run_picker_label
+from viz.telemetry import GENERATIONS_FILE, read_generation_telemetry, read_telemetry
+
+GENERATION_COLUMNS = [
+    ("generation", 0), ("numSolutions", 0), ("numberOfSpecies", 0), ("numberOfActiveSpecies", 0),
+    ("hasFitnessImproved", 0), ("generationsWithoutImprovement", 0), ("averageFitness", 1),
+    ("bestFitness", 1), ("innovationNumber", 0), ("averageGenomeSize", 1),
+    ("averageConnectionGenes", 1), ("averageFieldGenes", 1), ("fitnessCacheHits", 0),
+    ("fitnessCacheMisses", 0), ("truncatedEvaluations", 0), ("earlyTerminationThreshold", 1),
+    ("savedSimulationSteps", 0), ("bestSolutionId", 0), ("bestSolutionSpeciesId", 0),
+    ("validationViolations", 0), ("elapsedMilliseconds", 0),
+]
+
+
+def _header(columns):
+    data = b"NDTELEM1" + struct.pack("<II", 1, len(columns))
+    for name, type_code in columns:
+        encoded = name.encode("utf-8")
+        data += struct.pack("<BQ", type_code, len(encoded)) + encoded
+    return data
+
+
+def _batch(columns, rows):
+    """rows: list of tuples in column order, as TelemetryWriter::flush() lays them out"""
+    data = struct.pack("<Q", len(rows))
+    for index, (_name, type_code) in enumerate(columns):
+        data += struct.pack(f"<{len(rows)}{'qd'[type_code]}", *(row[index] for row in rows))
+    return data
+
+
+def _generation_row(generation, best_fitness, best_id):
+    return (generation, 10, 2, 2, 1, 0, best_fitness / 2, best_fitness, 5, 6.0, 2.0, 4.0,
+            3, 7, 0, float("-inf"), 0, best_id, 1, 0, 100 * generation)
+
+
+def test_read_telemetry_concatenates_batches_and_ignores_a_partial_one(tmp_path):
+    columns = [("generation", 0), ("bestFitness", 1)]
+    path = tmp_path / "telemetry.bin"
+    path.write_bytes(
+        _header(columns)
+        + _batch(columns, [(0, 0.5), (1, 0.75)])
+        + _batch(columns, [(2, 1.0)])
+        + struct.pack("<Q", 4) + b"cut short"
+    )
+
+    df = read_telemetry(path)
+    assert list(df.columns) == ["generation", "bestFitness"]
+    assert list(df["generation"]) == [0, 1, 2]
+    assert list(df["bestFitness"]) == [0.5, 0.75, 1.0]
+    assert df["generation"].dtype == "int64"
+
+
+def test_read_telemetry_rejects_other_files(tmp_path):
+    path = tmp_path / "per_generation_overview.txt"
+    path.write_text("Current generation: 0 Number of solutions: 10")
+    with pytest.raises(ValueError):
+        read_telemetry(path)
+
+
+def test_read_generation_telemetry_keeps_the_last_record_of_a_resumed_generation(tmp_path):
+    # a run resumed from its generation-1 checkpoint re-records generation 2
+    (tmp_path / GENERATIONS_FILE).write_bytes(
+        _header(GENERATION_COLUMNS)
+        + _batch(GENERATION_COLUMNS, [_generation_row(0, 0.2, 1), _generation_row(1, 0.4, 2), _generation_row(2, 0.5, 3)])
+        + _batch(GENERATION_COLUMNS, [_generation_row(2, 0.6, 4)])
+    )
+
+    df = read_generation_telemetry(tmp_path)
+    assert list(df["generation"]) == [0, 1, 2]
+    assert list(df["bestSolutionId"]) == [1, 2, 4]
+    assert read_generation_telemetry(tmp_path / "missing") is None
+
+
+def test_load_overview_prefers_telemetry_with_the_text_parser_column_names(tmp_path):
+    run_dir = tmp_path / "run"
+    run_dir.mkdir()
+    (run_dir / GENERATIONS_FILE).write_bytes(
+        _header(GENERATION_COLUMNS)
+        + _batch(GENERATION_COLUMNS, [_generation_row(1, 0.4, 8), _generation_row(0, 0.2, 7)])
+    )
+
+    df = load_overview(str(run_dir))
+    assert list(df.columns[:12]) == [
+        "generation", "num_solutions", "num_species", "num_active_species", "fitness_improved",
+        "gens_without_improvement", "avg_fitness", "best_fitness", "innovation_number",
+        "avg_genome_size", "avg_conn_genes", "avg_field_genes",
+    ]
+    assert list(df["generation"]) == [0, 1]
+    assert list(df["best_fitness"]) == [0.2, 0.4]
+    assert df["fitness_improved"].dtype == bool
+    assert "fitnessCacheMisses" in df.columns
+
+    assert get_best_solution_id(str(run_dir), 1) == 8
+    assert get_best_solution_id(str(run_dir), 5) is None
+    assert find_runs_with_overview(tmp_path) == [("run", run_dir)]
+    assert run_picker_label(str(run_dir)) == "run · 2 gen · best 0.400"
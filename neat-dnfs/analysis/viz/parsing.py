@@ -10,6 +10,7 @@ import streamlit as st
 
 from .cache import _disk_cache_read_df, _disk_cache_read_json, _disk_cache_write_df, _disk_cache_write_json, _fingerprint_dir, _run_cache_dir
 from .genome import collect_parameter_values, kernel_kinds_for_solution
+from .telemetry import GENERATIONS_FILE, read_generation_telemetry
 from .solution_record import _AGE_PARENTS_RE, _extract_mutation_events, _GENOME_SIZE_RE, categorize_mutation, find_solution_blob, parse_solution_blob  # noqa: F401  (_extract_mutation_events, categorize_mutation re-exported)
 
 def parse_overview_line(line: str):
@@ -55,9 +56,41 @@ def parse_overview_line(line: str):
     }
 
 
+# telemetry_generations.bin column -> the name parse_overview_line gives it
+_TELEMETRY_OVERVIEW_COLUMNS = {
+    "generation": "generation",
+    "numSolutions": "num_solutions",
+    "numberOfSpecies": "num_species",
+    "numberOfActiveSpecies": "num_active_species",
+    "hasFitnessImproved": "fitness_improved",
+    "generationsWithoutImprovement": "gens_without_improvement",
+    "averageFitness": "avg_fitness",
+    "bestFitness": "best_fitness",
+    "innovationNumber": "innovation_number",
+    "averageGenomeSize": "avg_genome_size",
+    "averageConnectionGenes": "avg_conn_genes",
+    "averageFieldGenes": "avg_field_genes",
+}
+
+
+def has_overview(run_dir: Path) -> bool:
+    """Whether run_dir holds a run's per-generation overview, as text or telemetry."""
+    return (run_dir / "per_generation_overview.txt").exists() or (run_dir / GENERATIONS_FILE).exists()
+
+
 @st.cache_data
 def load_overview(run_dir_str: str) -> pd.DataFrame:
+    """One row per generation. Read from telemetry_generations.bin when the run
+    wrote one, with the columns parse_overview_line produces first and the rest
+    of the telemetry after them; otherwise parsed from per_generation_overview.txt."""
     run_dir = Path(run_dir_str)
+    telemetry = read_generation_telemetry(run_dir)
+    if telemetry is not None and not telemetry.empty:
+        df = telemetry.rename(columns=_TELEMETRY_OVERVIEW_COLUMNS)
+        df["fitness_improved"] = df["fitness_improved"].astype(bool)
+        ordered = list(_TELEMETRY_OVERVIEW_COLUMNS.values())
+        return df[ordered + [c for c in df.columns if c not in ordered]]
+
     overview_path = run_dir / "per_generation_overview.txt"
     if not overview_path.exists():
         raise FileNotFoundError(f"Could not find {overview_path}")
@@ -134,8 +167,13 @@ def compute_topology_trajectory(run_dir_str: str) -> pd.DataFrame:
 @st.cache_data
 def get_best_solution_id(run_dir_str: str, generation0: int) -> int | None:
     """The id of the given generation's best-total-fitness individual, read from
-    per_generation_overview.txt's embedded solution blob -- no statistics/ scan."""
+    telemetry_generations.bin or per_generation_overview.txt's embedded solution
+    blob -- no statistics/ scan."""
     run_dir = Path(run_dir_str)
+    telemetry = read_generation_telemetry(run_dir)
+    if telemetry is not None:
+        match = telemetry.loc[telemetry["generation"] == generation0, "bestSolutionId"]
+        return int(match.iloc[-1]) if not match.empty else None
     overview_path = run_dir / "per_generation_overview.txt"
     if not overview_path.exists():
         return None
@@ -207,11 +245,9 @@ def trace_lineage(run_dir_str: str, start_generation0: int, start_solution_id: i
 def find_runs_with_overview(base_dir: Path):
     runs = []
     for child in sorted(base_dir.iterdir()):
-        if child.is_dir():
-            overview = child / "per_generation_overview.txt"
-            if overview.exists():
-                runs.append((child.name, child))
-    if not runs and (base_dir / "per_generation_overview.txt").exists():
+        if child.is_dir() and has_overview(child):
+            runs.append((child.name, child))
+    if not runs and has_overview(base_dir):
         # base_dir has no run subfolders but is itself a run (flat layout, e.g. the
         # checked-in data/AND, data/XOR samples) -- treat it as its own single run.
         runs.append((base_dir.name, base_dir))
@@ -259,6 +295,13 @@ def run_picker_label(run_dir_str: str) -> str:
     run_dir = Path(run_dir_str)
     label = prettify_run_timestamp(run_dir.name)
     overview_path = run_dir / "per_generation_overview.txt"
+    if not overview_path.exists():
+        # Only telemetry: the file is read whole, but as a handful of arrays.
+        telemetry = read_generation_telemetry(run_dir)
+        if telemetry is None or telemetry.empty:
+            return label
+        last = telemetry.iloc[-1]
+        return f"{label} · {int(last['generation']) + 1} gen · best {last['bestFitness']:.3f}"
     try:
         text = overview_path.read_text(encoding="utf-8", errors="replace")
     except OSError:
@@ -0,0 +1,68 @@
+"""Reader for the telemetry_*.bin files a run writes next to its text logs
+(tools::TelemetryWriter on the C++ side).
+
+A file is a header -- magic, version, then the type and name of every column --
+followed by batches: a row count, then each column's values back to back as
+int64 or float64 in the writer's byte order (little-endian on every platform
+neat-dnfs builds for). The columns are read straight into numpy arrays, with
+no per-line parsing."""
+
+import struct
+from pathlib import Path
+
+import numpy as np
+import pandas as pd
+
+MAGIC = b"NDTELEM1"
+VERSION = 1
+_DTYPES = {0: np.dtype("<i8"), 1: np.dtype("<f8")}  # TelemetryColumnType: Int64, Float64
+
+GENERATIONS_FILE = "telemetry_generations.bin"
+SPECIES_FILE = "telemetry_species.bin"
+PHASES_FILE = "telemetry_phases.bin"
+
+
+def read_telemetry(path) -> pd.DataFrame:
+    """One row per record, one column per telemetry column. An incomplete last
+    batch (a run killed mid-write) is ignored."""
+    data = Path(path).read_bytes()
+    if data[:8] != MAGIC:
+        raise ValueError(f"{path} is not a telemetry file")
+    version, num_columns = struct.unpack_from("<II", data, 8)
+    if version != VERSION:
+        raise ValueError(f"{path} has unsupported telemetry version {version}")
+    offset = 16
+    schema = []
+    for _ in range(num_columns):
+        type_code, name_size = struct.unpack_from("<BQ", data, offset)
+        offset += 9
+        schema.append((data[offset:offset + name_size].decode("utf-8"), _DTYPES[type_code]))
+        offset += name_size
+
+    chunks = {name: [] for name, _ in schema}
+    while offset + 8 <= len(data):
+        (rows,) = struct.unpack_from("<Q", data, offset)
+        if offset + 8 + rows * num_columns * 8 > len(data):
+            break
+        offset += 8
+        for name, dtype in schema:
+            chunks[name].append(np.frombuffer(data, dtype=dtype, count=rows, offset=offset))
+            offset += rows * 8
+
+    return pd.DataFrame({
+        name: np.concatenate(chunks[name]) if chunks[name] else np.empty(0, dtype=dtype)
+        for name, dtype in schema
+    })
+
+
+def read_generation_telemetry(run_dir) -> pd.DataFrame | None:
+    """telemetry_generations.bin of run_dir, one row per generation sorted by
+    generation, or None if the run has none. A run resumed from a checkpoint
+    appends to the file, so generations past the checkpoint can appear twice;
+    the later record wins."""
+    path = Path(run_dir) / GENERATIONS_FILE
+    if not path.exists():
+        return None
+    df = read_telemetry(path)
+    df = df.drop_duplicates("generation", keep="last").sort_values("generation")
+    return df.reset_index(drop=True)
@@ -2,6 +2,7 @@
 
 // PVS-Studio Static Code Analyzer for C, C++, C#, and Java: https://pvs-studio.com
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include "dnf_composer/application/application.h"
@@ -11,6 +12,7 @@
 #include "neat/ablation_presets.h"
 #include "neat_tools/logger.h"
 #include "neat_tools/key_listener.h"
+#include "neat_tools/thread_pool.h"
 #include "solution_registry.h"
 
 int main(int argc, char* argv[])
@@ -56,12 +58,35 @@ int main(int argc, char* argv[])
 		const int numberGenerations = opts.numGenerations.value_or(200);
 		const double targetFitness = opts.targetFitness.value_or(0.95);
 
+		// One evaluation pool for every run, so worker threads are created once.
+		const auto executor = std::make_shared<tools::ThreadPool>(
+			static_cast<size_t>(std::max(0, opts.threads.value_or(0))), opts.pinThreads);
+
 		for (int i = 0; i < numberRuns; i++)
 		{
-			const PopulationParameters parameters{ populationSize, numberGenerations, targetFitness };
+			PopulationParameters parameters{ populationSize, numberGenerations, targetFitness };
+			if (opts.earlyTermination)
+			{
+				parameters.earlyTerminationPolicy = EarlyTerminationPolicy::PruneCutoff;
+			}
+			if (opts.commonNoise)
+			{
+				parameters.noiseSource = NoiseSource::GenerationTape;
+			}
+			parameters.tracePhases = opts.tracePhases;
+			parameters.checkpointInterval = opts.checkpointEvery.value_or(10);
+			if (opts.seed)
+			{
+				parameters.seed = *opts.seed + static_cast<std::uint64_t>(i);
+			}
 			Population population{ parameters, task->makeFromTopology(topology) };
+			population.setExecutor(executor);
 
 			population.initialize();
+			if (i == 0 && opts.resume)
+			{
+				population.resumeFrom(*opts.resume);
+			}
 			KeyListener keyListener{ population };
 			population.evolve();
 		}
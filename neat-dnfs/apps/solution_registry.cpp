@@ -88,7 +88,8 @@ namespace neat_dnfs::examples
 		{
 			return flag == "--task" || flag == "--ablation" || flag == "--template"
 				|| flag == "--runs" || flag == "--pop" || flag == "--gens"
-				|| flag == "--target" || flag == "--evals";
+				|| flag == "--target" || flag == "--evals" || flag == "--threads"
+				|| flag == "--checkpoint-every" || flag == "--resume" || flag == "--seed";
 		}
 	}
 
@@ -109,6 +110,26 @@ namespace neat_dnfs::examples
 				options.helpRequested = true;
 				continue;
 			}
+			if (flag == "--pin-threads")
+			{
+				options.pinThreads = true;
+				continue;
+			}
+			if (flag == "--early-termination")
+			{
+				options.earlyTermination = true;
+				continue;
+			}
+			if (flag == "--common-noise")
+			{
+				options.commonNoise = true;
+				continue;
+			}
+			if (flag == "--trace-phases")
+			{
+				options.tracePhases = true;
+				continue;
+			}
 			if (!takesValue(flag))
 			{
 				throw std::invalid_argument("Unrecognized flag '" + flag + "'.");
@@ -127,6 +148,10 @@ namespace neat_dnfs::examples
 			else if (flag == "--gens") options.numGenerations = std::stoi(value);
 			else if (flag == "--target") options.targetFitness = std::stod(value);
 			else if (flag == "--evals") options.evaluations = std::stoi(value);
+			else if (flag == "--threads") options.threads = std::stoi(value);
+			else if (flag == "--checkpoint-every") options.checkpointEvery = std::stoi(value);
+			else if (flag == "--resume") options.resume = value;
+			else if (flag == "--seed") options.seed = std::stoull(value);
 		}
 		return options;
 	}
@@ -135,7 +160,9 @@ namespace neat_dnfs::examples
 	{
 		out << "Usage: " << exeName << " [--task NAME] [--ablation NAME] [--template PATH]\n"
 			<< "           [--runs N] [--pop N] [--gens N] [--target F] [--evals N]\n"
-			<< "           [--list] [--help]\n\n"
+			<< "           [--threads N] [--pin-threads] [--early-termination] [--common-noise]\n"
+			<< "           [--trace-phases]\n"
+			<< "           [--checkpoint-every N] [--resume DIR] [--seed N] [--list] [--help]\n\n"
 			<< "  --task NAME       Task to evolve/evaluate (default varies by binary). See --list.\n"
 			<< "  --ablation NAME   Ablation preset to apply before initialize() (default: none). See --list.\n"
 			<< "  --template PATH   Template JSON to load a starting solution from (default: the task's own).\n"
@@ -144,6 +171,14 @@ namespace neat_dnfs::examples
 			<< "  --gens N          Max generations per run.\n"
 			<< "  --target F        Target fitness that ends a run early.\n"
 			<< "  --evals N         Number of evaluate() calls (solution-evaluation binary only).\n"
+			<< "  --threads N       Evaluation worker threads (evolution binaries only; default: all cores).\n"
+			<< "  --pin-threads     Pin evaluation workers to CPUs (Linux only).\n"
+			<< "  --early-termination  Skip the remaining phases of evaluations that can no longer survive pruning.\n"
+			<< "  --common-noise    Evaluate each generation against one shared noise tape (evolution binaries only).\n"
+			<< "  --trace-phases    Write phase_trace.json (Chrome trace) to each run's folder; needs a NEAT_DNFS_PROFILING build.\n"
+			<< "  --checkpoint-every N  Generations between checkpoints of each run (evolution binaries only; default: 10, 0 disables).\n"
+			<< "  --resume DIR      Continue the run saved in DIR from its checkpoint as the first of --runs.\n"
+			<< "  --seed N          Reproducible runs, whatever the thread count; run i uses seed N + i.\n"
 			<< "  --list            List available tasks and ablation presets, then exit.\n"
 			<< "  --help            Show this message and exit.\n";
 	}
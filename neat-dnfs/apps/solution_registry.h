@@ -6,6 +6,7 @@
 // ablation preset (see neat/ablation_presets.h) at runtime instead of at
 // compile time, so an ablation sweep is a shell loop rather than a rebuild.
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -55,6 +56,14 @@ namespace neat_dnfs::examples
 		std::optional<int> numGenerations;
 		std::optional<double> targetFitness;
 		std::optional<int> evaluations;
+		std::optional<int> threads;
+		std::optional<int> checkpointEvery;
+		std::optional<std::string> resume;
+		std::optional<std::uint64_t> seed;
+		bool pinThreads = false;
+		bool earlyTermination = false;
+		bool commonNoise = false;
+		bool tracePhases = false;
 		bool listRequested = false;
 		bool helpRequested = false;
 	};
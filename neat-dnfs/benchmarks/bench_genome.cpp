@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "bench_helpers.h"
+
+using namespace neat_dnfs;
+
+namespace
+{
+    // Genome sizes after 0, 20 and 100 rounds of mutation: the minimal
+    // starting genome, a typical early-run genome and a late-run one.
+    void genomeSizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Arg(0)->Arg(20)->Arg(100);
+    }
+
+    const examples::TaskEntry& crossoverTask()
+    {
+        return examples::taskEntries().front();
+    }
+}
+
+static void BM_GenomeMutate(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const Genome base = bench::makeGenome(static_cast<int>(state.range(0)), 1);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Genome genome = base;
+        Genome::clearGenerationalInnovations();
+        state.ResumeTiming();
+
+        genome.mutate();
+        benchmark::DoNotOptimize(genome);
+    }
+    state.counters["connectionGenes"] = static_cast<double>(base.getConnectionGenes().size());
+}
+BENCHMARK(BM_GenomeMutate)->Apply(genomeSizes);
+
+static void BM_GenomeCompatibilityTerms(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const Genome first = bench::makeGenome(static_cast<int>(state.range(0)), 1);
+    const Genome second = bench::makeGenome(static_cast<int>(state.range(0)), 2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(first.compatibilityTerms(second));
+    }
+    state.counters["connectionGenes"] = static_cast<double>(first.getConnectionGenes().size());
+}
+BENCHMARK(BM_GenomeCompatibilityTerms)->Apply(genomeSizes);
+
+static void BM_SpeciesIsCompatible(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const int mutations = static_cast<int>(state.range(0));
+    const SolutionPtr representative = bench::makeSolution(crossoverTask(), mutations, 1);
+    const SolutionPtr candidate = bench::makeSolution(crossoverTask(), mutations, 2);
+    Species species;
+    species.setRepresentative(representative);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(species.isCompatible(candidate));
+    }
+}
+BENCHMARK(BM_SpeciesIsCompatible)->Apply(genomeSizes);
+
+static void BM_SolutionCrossover(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const int mutations = static_cast<int>(state.range(0));
+    const SolutionPtr first = bench::makeSolution(crossoverTask(), mutations, 1);
+    const SolutionPtr second = bench::makeSolution(crossoverTask(), mutations, 2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(first->crossover(second));
+    }
+}
+BENCHMARK(BM_SolutionCrossover)->Apply(genomeSizes);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "neat/genome.h"
+#include "neat/solution.h"
+#include "neat/species.h"
+#include "neat_tools/utils.h"
+#include "solution_registry.h"
+
+namespace neat_dnfs::bench {
+
+// Same reset the test binary does between runs, so global id and innovation
+// counters of one benchmark don't leak into the next.
+inline void resetGlobalState()
+{
+    Genome::resetGlobalInnovationNumber();
+    Genome::clearGenerationalInnovations();
+    Solution::resetUniqueIdentifier();
+    Species::resetUniqueIdentifier();
+}
+
+// Inputs are grown on a fixed seed so every run times the same genomes; only
+// the timed code itself draws from the usual per-thread engines.
+inline Genome makeGenome(const int mutations, const std::uint64_t seed)
+{
+    tools::utils::Xoshiro256pp engine(seed);
+    tools::utils::ScopedEngine scope(engine);
+
+    Genome genome;
+    genome.addInputGene({ DimensionConstants::xSize, DimensionConstants::dx });
+    genome.addOutputGene({ DimensionConstants::xSize, DimensionConstants::dx });
+    for (int i = 0; i < mutations; ++i)
+    {
+        genome.mutate();
+        Genome::clearGenerationalInnovations();
+    }
+    genome.clearLastMutations();
+    return genome;
+}
+
+// A task solution whose genome went through `mutations` rounds of mutation
+// from the task's minimal topology.
+inline SolutionPtr makeSolution(const examples::TaskEntry& task, const int mutations, const std::uint64_t seed)
+{
+    tools::utils::Xoshiro256pp engine(seed);
+    tools::utils::ScopedEngine scope(engine);
+
+    SolutionPtr solution = task.makeFromTopology(examples::defaultTopologyFor(task));
+    solution->initialize();
+    for (int i = 0; i < mutations; ++i)
+    {
+        solution->mutate();
+        Genome::clearGenerationalInnovations();
+    }
+    solution->clearLastMutations();
+    return solution;
+}
+
+} // namespace neat_dnfs::bench
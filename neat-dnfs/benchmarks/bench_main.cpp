@@ -0,0 +1,22 @@
+#include <benchmark/benchmark.h>
+#include <dnf_composer/tools/logger.h>
+
+#include "neat_tools/logger.h"
+
+// Both loggers are raised to ERROR before anything runs: per-generation and
+// per-evaluation INFO output would otherwise dominate the timings, and
+// dnf_composer's logger isn't safe to call from the population's workers.
+int main(int argc, char** argv)
+{
+	dnf_composer::tools::logger::Logger::setMinLogLevel(dnf_composer::tools::logger::LogLevel::ERROR);
+	neat_dnfs::tools::logger::Logger::setMinLogLevel(neat_dnfs::tools::logger::LogLevel::ERROR);
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_helpers.h"
+#include "neat/population.h"
+
+using namespace neat_dnfs;
+
+// Wall-clock time of one full generation (evaluate, speciate, reproduce and
+// select) of the first registered task, serial and on the population's own
+// thread pool. The population keeps evolving from one iteration to the next,
+// so later iterations time somewhat larger genomes.
+static void BM_Generation(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const auto& task = examples::taskEntries().front();
+    const SolutionPtr initialSolution = task.makeFromTopology(examples::defaultTopologyFor(task));
+
+    // A target above any reachable fitness, so no generation ends the run.
+    PopulationParameters parameters(static_cast<int>(state.range(0)), 0, 2.0, state.range(1) != 0);
+    Population population(parameters, initialSolution, false);
+    population.initialize();
+    for (auto _ : state)
+    {
+        population.setNumGenerations(population.getCurrentGeneration() + 1);
+        population.evolve();
+    }
+    state.counters["generations"] = static_cast<double>(population.getCurrentGeneration());
+    state.counters["species"] = static_cast<double>(population.getSpeciesList().size());
+}
+BENCHMARK(BM_Generation)
+    ->ArgNames({ "size", "parallel" })
+    ->Args({ 50, 0 })->Args({ 50, 1 })->Args({ 200, 1 })->Args({ 1000, 1 })
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "bench_helpers.h"
+
+using namespace neat_dnfs;
+
+namespace
+{
+    const examples::TaskEntry& phenotypeTask()
+    {
+        return examples::taskEntries().front();
+    }
+
+    // One evaluation of every registered task, on its minimal genome and on
+    // one grown by 20 rounds of mutation.
+    void evaluate(benchmark::State& state, const examples::TaskEntry& task)
+    {
+        bench::resetGlobalState();
+        const SolutionPtr solution = bench::makeSolution(task, static_cast<int>(state.range(0)), 1);
+        for (auto _ : state)
+        {
+            solution->evaluate();
+            benchmark::DoNotOptimize(solution->getFitness());
+        }
+        state.counters["fieldGenes"] = static_cast<double>(solution->getNumFieldGenes());
+        state.counters["connectionGenes"] = static_cast<double>(solution->getNumConnectionGenes());
+    }
+
+    const bool taskBenchmarksRegistered = []
+    {
+        for (const auto& task : examples::taskEntries())
+        {
+            benchmark::RegisterBenchmark(("BM_Evaluate/" + std::string(task.slug)).c_str(), evaluate, task)
+                ->Arg(0)->Arg(20)->Unit(benchmark::kMillisecond);
+        }
+        return true;
+    }();
+}
+
+static void BM_BuildPhenotype(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const SolutionPtr solution = bench::makeSolution(phenotypeTask(), static_cast<int>(state.range(0)), 1);
+    for (auto _ : state)
+    {
+        solution->buildPhenotype();
+
+        state.PauseTiming();
+        solution->clearPhenotype();
+        state.ResumeTiming();
+    }
+    state.counters["fieldGenes"] = static_cast<double>(solution->getNumFieldGenes());
+}
+BENCHMARK(BM_BuildPhenotype)->Arg(0)->Arg(20)->Arg(100);
+
+static void BM_ClearPhenotype(benchmark::State& state)
+{
+    bench::resetGlobalState();
+    const SolutionPtr solution = bench::makeSolution(phenotypeTask(), static_cast<int>(state.range(0)), 1);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        solution->buildPhenotype();
+        state.ResumeTiming();
+
+        solution->clearPhenotype();
+    }
+    state.counters["fieldGenes"] = static_cast<double>(solution->getNumFieldGenes());
+}
+BENCHMARK(BM_ClearPhenotype)->Arg(0)->Arg(20)->Arg(100);
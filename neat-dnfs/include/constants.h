@@ -21,6 +21,17 @@ namespace neat_dnfs
 		static constexpr std::string_view name			= "solution ";
 		static constexpr double deltaT				= 1;
 		static constexpr size_t maxSimulationSteps	= 500;
+
+		// end a Solution::runSimulation() phase early once every neural field
+		// has settled: no activation sample moves by more than the tolerance
+		// (plus steadyStateNoiseMultiple standard deviations of the per-step
+		// noise jitter) per step, nor in total, over steadyStateSteps
+		// consecutive steps. Off by default: near-threshold fields can rise
+		// slowly enough to pass as settled, which changes task fitness
+		static constexpr bool adaptiveStepping		= false;
+		static constexpr double steadyStateTolerance	= 1e-3;
+		static constexpr double steadyStateNoiseMultiple = 5.0;
+		static constexpr int steadyStateSteps			= 50;
 	};
 
 	struct DimensionConstants
@@ -33,6 +44,9 @@ namespace neat_dnfs
 	{
 		static constexpr std::string_view namePrefix	= "nn ";
 		static constexpr double amplitude		= 0.010;
+		// rows of the per-generation NoiseTape (NoiseSource::GenerationTape);
+		// longer evaluations wrap around it
+		static constexpr size_t tapeSteps		= 4096;
 	};
 
 	struct GaussStimulusConstants
@@ -49,7 +63,10 @@ namespace neat_dnfs
 		static constexpr std::string_view namePrefix	= "nf ";
 		static constexpr double tau					= 100;
 		static constexpr double restingLevel		= -10;
-		inline static const dnf_composer::element::SigmoidFunction activationFunction{0.0, 5.0};
+		// sigmoid of every field: threshold (x shift) and steepness
+		static constexpr double activationThreshold	= 0.0;
+		static constexpr double activationSteepness	= 5.0;
+		inline static const dnf_composer::element::SigmoidFunction activationFunction{activationThreshold, activationSteepness};
 
 		static constexpr double tauMinVal			= 1.0;
 		static constexpr double tauMaxVal			= 200.0;
@@ -120,6 +137,14 @@ namespace neat_dnfs
 		static constexpr double ampGlobStep 	= 0.05;
 	};
 
+	// Genes never create oscillatory kernels, but keep one read from an
+	// existing phenotype (see Solution::translatePhenotypeToGenome).
+	struct OscillatoryKernelConstants
+	{
+		static constexpr std::string_view namePrefix				= "ok ";
+		static constexpr std::string_view namePrefixConnectionGene	= "ok cg ";
+	};
+
 	/// @brief Per-mechanism overrides for ablation studies (issue #76). Unlike the
 	/// other constant blocks in this file, these are runtime-mutable: a preset in
 	/// AblationPresets sets them once before Population::initialize(), and they are
@@ -251,6 +276,13 @@ namespace neat_dnfs
 	{
 		static constexpr uint8_t minInitialInputGenes	= 1;
 		static constexpr uint8_t minInitialOutputGenes	= 1;
+
+		// keep the phenotype simulation alive between evaluate() calls and only
+		// patch the elements of mutated genes, instead of rebuilding it every time
+		static constexpr bool persistentPhenotype		= true;
+		// solutions of each task type SolutionPool keeps parked for reuse;
+		// a bit over one generation's worth of offspring
+		static constexpr size_t poolCapacity			= 2048;
 	};
 
 	struct PopulationConstants
@@ -274,10 +306,23 @@ namespace neat_dnfs
 		static constexpr bool logSpecies				= false;
 
 		static constexpr bool saveOverview				= true;
+		// per_generation_overview.txt, one prose line per generation; the
+		// telemetry files below hold the same numbers in binary
+		static constexpr bool saveOverviewText			= true;
+		// telemetry_{generations,species,phases}.bin (see tools::TelemetryWriter),
+		// written telemetryBatchRows records at a time
+		static constexpr bool saveTelemetry				= true;
+		static constexpr int telemetryBatchRows			= 32;
 		static constexpr bool savePerGenerationOverview	= true;
 		static constexpr bool saveChampions				= true;
 		static constexpr bool saveBestSolutions			= true;
 		static constexpr bool saveSolutions				= true;
 		static constexpr bool saveSpecies				= true;
+		// write the files above on a background thread so disk I/O overlaps
+		// with reproduction and the next generation's evaluation
+		static constexpr bool asyncFileWrites			= true;
+		// written to the run's directory every
+		// PopulationParameters::checkpointInterval generations
+		static constexpr const char* checkpointFileName	= "checkpoint.bin";
 	};
 }
\ No newline at end of file
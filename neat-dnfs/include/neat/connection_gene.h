@@ -2,11 +2,9 @@
 #include <memory>
 #include <random>
 
-#include <dnf_composer/elements/gauss_kernel.h>
-#include <dnf_composer/elements/mexican_hat_kernel.h>
-#include <dnf_composer/elements/oscillatory_kernel.h>
 #include "neat_tools/utils.h"
 #include "constants.h"
+#include "kernel_parameters.h"
 
 namespace neat_dnfs
 {
@@ -40,11 +38,15 @@ namespace neat_dnfs
 		void print() const;
 	};
 
+	/// @brief A coupling between two field genes.
+	///
+	/// Like FieldGene, it stores only its kernel's parameters; the coupling
+	/// kernel element is built per phenotype.
 	class ConnectionGene
 	{
 	private:
 		ConnectionGeneParameters parameters;
-		KernelPtr kernel;
+		KernelParameters kernelParameters;
 		std::string mutationsInLastGeneration;
 	public:
 		ConnectionGene(ConnectionTuple connectionTuple, int innov);
@@ -53,13 +55,17 @@ namespace neat_dnfs
 			const dnf_composer::element::GaussKernelParameters& gkp);
 		ConnectionGene(ConnectionTuple connectionTuple, int innov,
 			const dnf_composer::element::MexicanHatKernelParameters& mhkp);
+		ConnectionGene(ConnectionTuple connectionTuple, int innov,
+			const KernelParameters& kernelParameters);
 
 		ConnectionGene(const ConnectionGeneParameters& parameters,
 			const dnf_composer::element::GaussKernelParameters& gkp);
 		ConnectionGene(const ConnectionGeneParameters& parameters,
 			const dnf_composer::element::MexicanHatKernelParameters& mhkp);
 
-		ConnectionGene(ConnectionTuple connectionTuple, int innov, KernelPtr kernel);
+		/// @brief Takes its kernel parameters from an existing kernel element,
+		/// which the gene does not keep.
+		ConnectionGene(ConnectionTuple connectionTuple, int innov, const KernelPtr& kernel);
 
 		void mutate();
 		void clearLastMutations();
@@ -72,6 +78,10 @@ namespace neat_dnfs
 
 		[[nodiscard]] ConnectionGeneParameters getParameters() const;
 		[[nodiscard]] std::string getMutationsInLastGeneration() const;
+		[[nodiscard]] const KernelParameters& getKernelParameters() const { return kernelParameters; }
+		[[nodiscard]] dnf_composer::element::ElementLabel getKernelLabel() const { return kernelLabelOf(kernelParameters); }
+		[[nodiscard]] std::string getKernelName() const;
+		/// @brief Builds a new coupling kernel element from this gene's parameters.
 		[[nodiscard]] KernelPtr getKernel() const;
 		[[nodiscard]] int getInnovationNumber() const;
 		[[nodiscard]] int getInFieldGeneId() const;
@@ -84,10 +94,16 @@ namespace neat_dnfs
 		[[nodiscard]] std::string toString() const;
 		void print() const;
 		[[nodiscard]] ConnectionGene clone() const;
+
+		/// @brief Writes every parameter of the gene, for checkpoints.
+		void serialize(tools::BinaryWriter& writer) const;
+		/// @brief Rebuilds a gene serialize() wrote, without drawing random numbers.
+		/// @throws std::runtime_error on corrupt or truncated data.
+		[[nodiscard]] static ConnectionGene deserialize(tools::BinaryReader& reader);
 	private:
-		void initializeKernel(const dnf_composer::element::ElementDimensions& dimensions);
-		void initializeGaussKernel(const dnf_composer::element::ElementDimensions& dimensions);
-		void initializeMexicanHatKernel(const dnf_composer::element::ElementDimensions& dimensions);
+		static KernelParameters makeKernelParameters();
+		static dnf_composer::element::GaussKernelParameters makeGaussKernelParameters();
+		static dnf_composer::element::MexicanHatKernelParameters makeMexicanHatKernelParameters();
 
 		void mutateKernel();
 		void mutateKernelType();
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "constants.h"
+#include "kernel_parameters.h"
+#include "tape_noise.h"
 
 namespace neat_dnfs
 {
@@ -29,20 +31,28 @@ namespace neat_dnfs
 		void print() const;
 	};
 
+	/// @brief A neural field node: the field itself, its self-excitation kernel and its noise.
+	///
+	/// The gene only stores the parameters of those three elements; the
+	/// dnf_composer elements are built when a phenotype is (see
+	/// Solution::buildPhenotype()), so copying a gene is cheap.
 	class FieldGene
 	{
 	private:
 		FieldGeneParameters parameters;
-		NeuralFieldPtr neuralField;
-		KernelPtr kernel;
-		NormalNoisePtr noise;
+		dnf_composer::element::ElementDimensions dimensions;
+		dnf_composer::element::NeuralFieldParameters neuralFieldParameters;
+		KernelParameters kernelParameters;
+		dnf_composer::element::NormalNoiseParameters noiseParameters;
 		std::string mutationsInLastGeneration;
 	public:
 		explicit FieldGene(const FieldGeneParameters& parameters,
 		                   const dnf_composer::element::ElementDimensions& dimensions = dnf_composer::element::ElementDimensions{100, 1.0});
+		/// @brief Takes its field and kernel parameters from existing elements,
+		/// which the gene does not keep.
 		FieldGene(const FieldGeneParameters& parameters,
 			const NeuralFieldPtr& neuralField, 
-			KernelPtr kernel);
+			const KernelPtr& kernel);
 		FieldGene(const FieldGeneParameters& parameters, const FieldGene& other);
 
 		void setAsInput(const dnf_composer::element::ElementDimensions& dimensions);
@@ -54,9 +64,23 @@ namespace neat_dnfs
 
 		[[nodiscard]] FieldGeneParameters getParameters() const;
 		[[nodiscard]] std::string getMutationsInLastGeneration() const;
+		[[nodiscard]] const dnf_composer::element::ElementDimensions& getDimensions() const { return dimensions; }
+		[[nodiscard]] const dnf_composer::element::NeuralFieldParameters& getNeuralFieldParameters() const { return neuralFieldParameters; }
+		[[nodiscard]] const KernelParameters& getKernelParameters() const { return kernelParameters; }
+		[[nodiscard]] dnf_composer::element::ElementLabel getKernelLabel() const { return kernelLabelOf(kernelParameters); }
+		[[nodiscard]] const dnf_composer::element::NormalNoiseParameters& getNoiseParameters() const { return noiseParameters; }
+		[[nodiscard]] std::string getNeuralFieldName() const;
+		[[nodiscard]] std::string getKernelName() const;
+		[[nodiscard]] std::string getNoiseName() const;
+		/// @brief Builds a new NeuralField element from this gene's parameters.
 		[[nodiscard]] std::shared_ptr<dnf_composer::element::NeuralField> getNeuralField() const;
+		/// @brief Builds a new self-excitation kernel element from this gene's parameters.
 		[[nodiscard]] std::shared_ptr<dnf_composer::element::Kernel> getKernel() const;
+		/// @brief Builds a new NormalNoise element from this gene's parameters.
 		[[nodiscard]] std::shared_ptr<dnf_composer::element::NormalNoise> getNoise() const;
+		/// @brief Builds a TapeNoise element reading @p tape on this gene's lane
+		/// (its id), or a plain NormalNoise if @p tape is null.
+		[[nodiscard]] std::shared_ptr<dnf_composer::element::NormalNoise> getNoise(const std::shared_ptr<const tools::NoiseTape>& tape) const;
 
 		bool operator==(const FieldGene& /*other*/) const;
 		/// @brief True if both genes share identical parameters and kernel values (deep equality), unlike @c operator== which compares by id.
@@ -64,12 +88,25 @@ namespace neat_dnfs
 		[[nodiscard]] std::string toString() const;
 		void print() const;
 		[[nodiscard]] FieldGene clone() const;
+
+		/// @brief Writes every parameter of the gene, for checkpoints.
+		void serialize(tools::BinaryWriter& writer) const;
+		/// @brief Rebuilds a gene serialize() wrote, without drawing random numbers.
+		/// @throws std::runtime_error on corrupt or truncated data.
+		[[nodiscard]] static FieldGene deserialize(tools::BinaryReader& reader);
 	private:
-		void initializeNeuralField(const dnf_composer::element::ElementDimensions& dimensions);
-		void initializeKernel(const dnf_composer::element::ElementDimensions& dimensions);
-		void initializeGaussKernel(const dnf_composer::element::ElementDimensions& dimensions);
-		void initializeMexicanHatKernel(const dnf_composer::element::ElementDimensions& dimensions);
-		void initializeNoise(const dnf_composer::element::ElementDimensions& dimensions);
+		FieldGene(const FieldGeneParameters& parameters,
+			const dnf_composer::element::ElementDimensions& dimensions,
+			const dnf_composer::element::NeuralFieldParameters& neuralFieldParameters,
+			const KernelParameters& kernelParameters,
+			const dnf_composer::element::NormalNoiseParameters& noiseParameters);
+
+		static dnf_composer::element::NeuralFieldParameters makeNeuralFieldParameters();
+		static KernelParameters makeKernelParameters();
+		static dnf_composer::element::GaussKernelParameters makeGaussKernelParameters();
+		static dnf_composer::element::MexicanHatKernelParameters makeMexicanHatKernelParameters();
+		static dnf_composer::element::NormalNoiseParameters makeNoiseParameters();
+		void setAs(FieldGeneType type, const dnf_composer::element::ElementDimensions& dimensions);
 
 		void mutateKernel();
 		void mutateGaussKernel();
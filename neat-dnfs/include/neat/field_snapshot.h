@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "constants.h"
+
+namespace neat_dnfs
+{
+	/// @brief Everything the fitness helpers read of a field at one instant,
+	/// computed in a single pass over its activation.
+	///
+	/// Tasks score a field with several helpers at the same checkpoint; each
+	/// reads the snapshot Solution took of the field after its last step
+	/// instead of scanning the field again (see Solution::getFieldSnapshot()).
+	/// take() refills the buffers of an existing snapshot, so retaking one
+	/// every checkpoint doesn't allocate once the bumps have been seen.
+	struct FieldSnapshot
+	{
+		std::vector<double> activation;
+		double dx = 1.0;
+		double restingLevel = 0.0;
+		double highestActivation = 0.0;
+		size_t highestActivationIndex = 0;
+		double lowestActivation = 0.0;
+		double meanActivation = 0.0;
+		/// Maximal runs of samples whose activation is above 0, the sigmoid's
+		/// threshold. A bump starts and ends at the positions of the first and
+		/// last samples of its run; its centroid is the midpoint of the run,
+		/// its width the run's extent (samples * dx) and its amplitude the
+		/// highest activation in it. Fields are circular, so a run touching
+		/// both edges is one bump whose startPosition lies past its
+		/// endPosition.
+		std::vector<dnf_composer::element::NeuralFieldBump> bumps;
+
+		/// @brief Recomputes every member from @p fieldActivation.
+		/// @throws std::invalid_argument if @p fieldActivation is empty.
+		void take(std::span<const double> fieldActivation, double d_x, double fieldRestingLevel);
+
+		/// @brief Converts a spatial position into an index into activation,
+		/// clamping to the field's sample range.
+		/// @details Positions passed to fitness helpers come from genome-derived
+		/// stimulus parameters and task definitions, and can legitimately fall on or
+		/// beyond a field's upper spatial bound (e.g. position == field size * d_x,
+		/// the field's own extent). Clamping keeps lookups well-defined at that
+		/// boundary instead of indexing past the end of the buffer.
+		/// @return An index in [0, activation.size() - 1].
+		[[nodiscard]] size_t indexOf(double position) const;
+		[[nodiscard]] double activationAt(double position) const { return activation[indexOf(position)]; }
+		[[nodiscard]] double highestActivationPosition() const { return static_cast<double>(highestActivationIndex) * dx; }
+		[[nodiscard]] bool hasBumps() const { return !bumps.empty(); }
+	private:
+		void mergeWrappedBump();
+	};
+
+	/// @brief The bumps of a field, as FieldSnapshot detects them.
+	[[nodiscard]] std::vector<dnf_composer::element::NeuralFieldBump> findBumps(std::span<const double> activation, double dx);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "solution.h"
+
+namespace neat_dnfs
+{
+	/// @brief How Population reuses the fitness of genomes it has already simulated.
+	enum class FitnessCachePolicy
+	{
+		Disabled,	///< Every solution is simulated every generation.
+		Reuse,		///< An unchanged genome keeps the fitness of its first evaluation; only sound for noise-free tasks.
+		Resample	///< An unchanged genome is re-simulated until it has N samples, then reuses their average.
+	};
+
+	/// @brief Population-level fitness cache keyed by Genome::contentHash().
+	///
+	/// Elites, carried-over champions and offspring that came out of reproduction
+	/// unmutated all share a genome with an individual that was already simulated;
+	/// the cache restores their fitness instead of paying for another simulation.
+	/// Entries only live as long as some solution in the population carries the
+	/// genome, so the cache never grows beyond the population size. Each entry
+	/// also keeps the genome's gene counts, and a hash hit whose counts differ is
+	/// treated as a collision and simulated.
+	///
+	/// Not thread-safe: restore() and record() are called from Population's main
+	/// thread, before and after the (possibly parallel) evaluation of the misses.
+	class FitnessCache
+	{
+	private:
+		struct GenomeKey
+		{
+			std::uint64_t fieldGenes = 0;
+			std::uint64_t connectionGenes = 0;
+			std::uint64_t enabledConnectionGenes = 0;
+
+			bool operator==(const GenomeKey&) const = default;
+		};
+
+		struct Entry
+		{
+			GenomeKey key;
+			double fitness = 0.0;
+			std::vector<double> partialFitness;
+			int samples = 0;
+		};
+
+		FitnessCachePolicy policy;
+		int samples;
+		std::unordered_map<std::uint64_t, Entry> entries;
+		std::unordered_map<std::uint64_t, int> liveGenomes;
+		std::unordered_map<std::uint64_t, std::pair<GenomeKey, SolutionPtr>> firstOccurrences;
+		std::vector<std::pair<std::uint64_t, GenomeKey>> pendingHashes;
+		std::vector<std::pair<SolutionPtr, SolutionPtr>> duplicates;
+		int hits = 0;
+		int misses = 0;
+	public:
+		/// @param policy   Reuse policy, see FitnessCachePolicy.
+		/// @param samples  Samples averaged per genome under FitnessCachePolicy::Resample
+		///                 (ignored otherwise); must be greater than 0.
+		explicit FitnessCache(FitnessCachePolicy policy = FitnessCachePolicy::Disabled, int samples = 1);
+
+		/// @brief Restores cached fitness onto every solution whose genome has a
+		/// usable entry, and resets the hit/miss counters for this generation.
+		/// @return The solutions that still need to be simulated, in population order.
+		std::vector<SolutionPtr> restore(const std::vector<SolutionPtr>& solutions);
+		/// @brief Stores the fitness of the solutions returned by the last restore()
+		/// once they have been evaluated. Under Resample the new sample is folded
+		/// into the running average, which is written back onto the solution.
+		/// Entries for genomes no longer in the population are dropped, and
+		/// truncated evaluations (SolutionParameters::evaluationTruncated) are
+		/// never stored, so those genomes are simulated again next time.
+		void record(const std::vector<SolutionPtr>& evaluated);
+		void clear();
+
+		/// @brief Writes the cached entries, for checkpoints. Only meaningful
+		/// between generations, when no restore() is awaiting its record().
+		void serialize(tools::BinaryWriter& writer) const;
+		/// @brief Replaces the cached entries with those serialize() wrote.
+		/// @throws std::runtime_error on corrupt or truncated data.
+		void deserialize(tools::BinaryReader& reader);
+
+		[[nodiscard]] FitnessCachePolicy getPolicy() const { return policy; }
+		[[nodiscard]] int getHits() const { return hits; }
+		[[nodiscard]] int getMisses() const { return misses; }
+		[[nodiscard]] size_t size() const { return entries.size(); }
+	private:
+		static GenomeKey makeKey(const Genome& genome);
+	};
+}
@@ -9,6 +9,14 @@
 
 namespace neat_dnfs
 {
+	/// @brief The three genome-dependent terms of the NEAT compatibility distance.
+	struct CompatibilityTerms
+	{
+		int excessGenes = 0;
+		int disjointGenes = 0;
+		double averageConnectionDifference = 0.0;
+	};
+
 	/// @brief Encodes a candidate solution as a set of field genes and connection genes.
 	///
 	/// Implements the NEAT genome representation: a graph of neural field nodes (FieldGene)
@@ -23,6 +31,13 @@ namespace neat_dnfs
 		static std::map<ConnectionTuple, int> connectionTupleAndInnovationNumberWithinGeneration;
 		static std::mutex innovationMutex; ///< Guards globalInnovationNumber and the generational innovation map.
 		std::string mutationsInLastGeneration;
+		// Innovation numbers of connectionGenes in ascending order, with each
+		// gene's kernel amplitude and width at the same index. Updated at every
+		// site that adds, removes or mutates a connection gene, so
+		// compatibilityTerms() is a single merge over contiguous arrays.
+		std::vector<int> sortedInnovationNumbers;
+		std::vector<double> sortedKernelAmplitudes;
+		std::vector<double> sortedKernelWidths;
 	public:
 		Genome() = default;
 		~Genome() = default;
@@ -42,7 +57,12 @@ namespace neat_dnfs
 		/// Must be called at the end of each generation before the next round of mutations.
 		static void clearGenerationalInnovations();
 		static void resetGlobalInnovationNumber();
+		/// @brief Restores the innovation counter of a checkpointed run.
+		static void setGlobalInnovationNumber(int innovationNumber);
 		void clearLastMutations();
+		/// @brief Removes every gene but keeps the storage, so a recycled
+		/// solution's next genome is rebuilt without reallocating.
+		void clear();
 		void removeConnectionGene(int innov);
 
 		/// @return A const reference to this genome's field genes.
@@ -59,6 +79,10 @@ namespace neat_dnfs
 		[[nodiscard]] int disjointGenes(const Genome& other) const;
 		/// @brief Mean absolute difference in kernel parameters across matching connection genes.
 		[[nodiscard]] double averageConnectionDifference(const Genome& other) const;
+		/// @brief excessGenes(), disjointGenes() and averageConnectionDifference()
+		/// computed together in one allocation-free pass over both genomes'
+		/// sorted innovation numbers.
+		[[nodiscard]] CompatibilityTerms compatibilityTerms(const Genome& other) const;
 
 		void addFieldGene(const FieldGene& fieldGene);
 		void addConnectionGene(const ConnectionGene& connectionGene);
@@ -82,9 +106,20 @@ namespace neat_dnfs
 		[[nodiscard]] FieldGene getFieldGeneById(int id) const;
 
 		[[nodiscard]] bool isEmpty() const;
+		/// @brief Hash over everything that shapes the phenotype: field gene ids,
+		/// types and neural field/kernel/noise parameters, plus each connection
+		/// gene's tuple, enabled flag and kernel parameters. Innovation numbers are
+		/// left out, so genomes that build identical phenotypes hash alike.
+		[[nodiscard]] std::uint64_t contentHash() const;
 		bool operator==(const Genome& other) const;
 		[[nodiscard]] std::string toString() const;
 		void print() const;
+
+		/// @brief Writes every gene, in order, for checkpoints.
+		void serialize(tools::BinaryWriter& writer) const;
+		/// @brief Replaces this genome's genes with those serialize() wrote.
+		/// @throws std::runtime_error on corrupt or truncated data.
+		void deserialize(tools::BinaryReader& reader);
 	private:
 		/// @brief Draws two distinct field gene ids to form a candidate connection.
 		/// @return The chosen {inFieldGeneId, outFieldGeneId} tuple, or {0, 0} if
@@ -104,6 +139,10 @@ namespace neat_dnfs
 		[[nodiscard]] ConnectionGene* getEnabledConnectionGene();
 
 		void addConnectionGene(ConnectionTuple connectionTuple);
+		/// @brief Inserts @p gene into the sorted innovation index, or refreshes
+		/// its kernel amplitude and width if its innovation number is already there.
+		void indexConnectionGene(const ConnectionGene& gene);
+		void unindexConnectionGene(int innov);
 		void addGene();
 		void mutateGene();
 		void addConnectionGene();
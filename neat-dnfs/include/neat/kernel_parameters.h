@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <variant>
+
+#include <dnf_composer/elements/gauss_kernel.h>
+#include <dnf_composer/elements/mexican_hat_kernel.h>
+#include <dnf_composer/elements/oscillatory_kernel.h>
+#include "constants.h"
+#include "neat_tools/binary_io.h"
+
+namespace neat_dnfs
+{
+	/// @brief Value-type parameters of a gene's kernel.
+	///
+	/// Genes hold this instead of a dnf_composer Kernel element, so copying a
+	/// gene or a genome copies a few doubles rather than an element with its
+	/// sampled kernel buffers. The element itself is only built (makeKernel())
+	/// when a phenotype needs it.
+	using KernelParameters = std::variant<
+		dnf_composer::element::GaussKernelParameters,
+		dnf_composer::element::MexicanHatKernelParameters,
+		dnf_composer::element::OscillatoryKernelParameters>;
+
+	/// @return The element label of the kernel @p parameters describe.
+	[[nodiscard]] dnf_composer::element::ElementLabel kernelLabelOf(const KernelParameters& parameters);
+	/// @brief Reads the parameters of an existing kernel element.
+	/// @throws std::invalid_argument if @p kernel is null or of a kernel type
+	///         KernelParameters can't hold.
+	[[nodiscard]] KernelParameters kernelParametersOf(const KernelPtr& kernel);
+	/// @brief Builds a new kernel element from @p parameters.
+	[[nodiscard]] KernelPtr makeKernel(const dnf_composer::element::ElementCommonParameters& commonParameters,
+		const KernelParameters& parameters);
+	/// @brief Copies @p parameters onto an existing kernel element in place.
+	/// @return False if @p kernel is not of the type @p parameters describe.
+	bool applyKernelParameters(const KernelPtr& kernel, const KernelParameters& parameters);
+	/// @brief True if both describe the same kernel type with the same
+	/// evolvable parameters (the ones mutation and the compatibility distance
+	/// look at).
+	[[nodiscard]] bool sameKernelParameters(const KernelParameters& a, const KernelParameters& b);
+	/// @brief Mixes the kernel type and its evolvable parameters into @p hash.
+	void hashKernelParameters(std::uint64_t& hash, const KernelParameters& parameters);
+	/// @brief Writes the kernel type and every parameter of it, for checkpoints.
+	/// @throws std::invalid_argument for oscillatory kernels, which evolution
+	///         never creates (they only come from templates).
+	void serializeKernelParameters(tools::BinaryWriter& writer, const KernelParameters& parameters);
+	/// @brief Reads what serializeKernelParameters() wrote.
+	/// @throws std::runtime_error on an unknown kernel type or truncated data.
+	[[nodiscard]] KernelParameters deserializeKernelParameters(tools::BinaryReader& reader);
+}
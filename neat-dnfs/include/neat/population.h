@@ -2,13 +2,19 @@
 
 #include <array>
 #include <atomic>
-#include <future>
+#include <functional>
+#include <iosfwd>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "fitness_cache.h"
 #include "genome.h"
+#include "neat_tools/profiler.h"
+#include "neat_tools/thread_pool.h"
 #include "solution.h"
 #include "species.h"
 
@@ -25,7 +31,6 @@ namespace neat_dnfs
 		UniqueSolutions,
 		Elitism,
 		UniqueGenesInGenomes,
-		UniqueKernelAndNeuralFieldPtrs,
 		SpeciesHaveUniqueRepresentative,
 		AssignmentIntoSpecies,
 		Count
@@ -42,10 +47,23 @@ namespace neat_dnfs
 		Throw
 	};
 
+	/// @brief How much of the population the invariant checks look at each
+	/// generation. Every check runs in time linear in what it looks at;
+	/// Sampled additionally limits the per-genome checks to
+	/// PopulationParameters::validationSampleSize solutions drawn anew each
+	/// generation, so they stay cheap at any population size.
+	/// ValidationPolicy::Throw always validates in Full.
+	enum class ValidationMode
+	{
+		Off,
+		Sampled,
+		Full
+	};
+
 	/// @brief Accumulates invariant-check violations observed during a run.
-	/// Messages are capped (not one per violation) since an O(n^2) check at a
-	/// large population size can otherwise emit far more strings than anyone
-	/// will read; counts remain exact regardless of the cap.
+	/// Messages are capped (not one per violation) since a systematic fault
+	/// at a large population size can otherwise emit far more strings than
+	/// anyone will read; counts remain exact regardless of the cap.
 	struct ValidationReport
 	{
 		static constexpr size_t maxRetainedMessages = 32;
@@ -70,6 +88,21 @@ namespace neat_dnfs
 		ValidationCheck check;
 	};
 
+	/// @brief Which fitness an evaluation must still be able to reach to keep
+	/// running (see Solution::continueEvaluation()).
+	enum class EarlyTerminationPolicy
+	{
+		Disabled,	///< Every evaluation runs all of its phases.
+		PruneCutoff	///< Stop once a solution can't reach the fitness that ranked just inside the top (1 - PopulationConstants::pruneRatio) of the previous generation.
+	};
+
+	/// @brief Where the field noise of an evaluation comes from.
+	enum class NoiseSource
+	{
+		Independent,	///< Every noise element draws its own noise each step.
+		GenerationTape	///< Every evaluation of a generation reads one shared NoiseTape, so individuals are compared on the same noise.
+	};
+
 	/// @brief Configuration for a NEAT population run.
 	struct PopulationParameters
 	{
@@ -77,7 +110,23 @@ namespace neat_dnfs
 		int currentGeneration{0};
 		int numGenerations;
 		double targetFitness; ///< Evolution stops early when the best solution reaches this fitness.
-		bool parallelEvolution; ///< Evaluate solutions concurrently via std::async.
+		bool parallelEvolution; ///< Evaluate solutions concurrently on the population's ThreadPool.
+		int numThreads{0}; ///< Worker threads of the ThreadPool the population creates; 0 uses hardware_concurrency().
+		bool pinThreads{false}; ///< Pin those workers to CPUs (Linux only).
+		FitnessCachePolicy fitnessCachePolicy{FitnessCachePolicy::Resample}; ///< How fitness of unchanged genomes is reused across generations; Reuse is only sound for noise-free tasks.
+		int fitnessCacheSamples{5}; ///< Samples averaged per genome under FitnessCachePolicy::Resample.
+		EarlyTerminationPolicy earlyTerminationPolicy{EarlyTerminationPolicy::Disabled}; ///< When phase-aware tasks skip their remaining phases.
+		int checkpointInterval{0}; ///< Generations between checkpoints written to the run's directory (needs file IO); 0 writes none.
+		NoiseSource noiseSource{NoiseSource::Independent}; ///< Independent or common-random-number field noise.
+		ValidationMode validationMode{ValidationMode::Off}; ///< Which invariant checks run each generation (Full regardless under ValidationPolicy::Throw).
+		int validationSampleSize{64}; ///< Solutions whose genomes ValidationMode::Sampled checks per generation.
+		bool tracePhases{false}; ///< Keep every timed phase and write them to phase_trace.json at the end of the run (needs file IO and a NEAT_DNFS_PROFILING build).
+		/// Seeded mode: the population draws from an engine seeded with this
+		/// value, and each evaluation and mutation from a stream of its own
+		/// derived from (seed, generation, solution id), so the run is the same
+		/// whatever the thread count. Unset draws from per-thread engines seeded
+		/// from entropy.
+		std::optional<std::uint64_t> seed;
 
 		explicit PopulationParameters(int size = 100, int numGenerations = 1000, double targetFitness = 0.95, bool parallelEvolution = true);
 	};
@@ -111,6 +160,11 @@ namespace neat_dnfs
 		double averageGenomeSize = 0.0;
 		double averageConnectionGenes = 0.0;
 		double averageFieldGenes = 0.0;
+		int fitnessCacheHits = 0; ///< Solutions whose fitness was restored instead of simulated.
+		int fitnessCacheMisses = 0; ///< Solutions that were simulated.
+		int truncatedEvaluations = 0; ///< Simulations stopped early by the EarlyTerminationPolicy.
+		double earlyTerminationThreshold = 0.0; ///< Threshold those simulations were held to.
+		long long savedSimulationSteps = 0; ///< Steps skipped by SimulationConstants::adaptiveStepping across this generation's simulations.
 
 		PerGenerationStatistics() = default;
 	};
@@ -145,6 +199,23 @@ namespace neat_dnfs
 		std::unique_ptr<PopulationFileManager> fileManager;
 		ValidationReport validationReport;
 		ValidationPolicy validationPolicy = defaultValidationPolicy;
+		FitnessCache fitnessCache;
+		std::shared_ptr<tools::ThreadPool> executor;
+		// Fitness the next generation's evaluations must be able to reach,
+		// derived from this generation's results by updateEarlyTerminationThreshold().
+		double earlyTerminationThreshold = -std::numeric_limits<double>::infinity();
+		// Set when evaluate() already ran the genome-only species assignment
+		// alongside the simulations, so speciate() doesn't repeat it.
+		bool solutionsAssignedToSpecies = false;
+		// Engine installed on the calling thread while initialize() and evolve()
+		// run, when PopulationParameters::seed is set.
+		std::unique_ptr<tools::utils::Xoshiro256pp> seededEngine;
+		// Seeds the per-generation draw of ValidationMode::Sampled, which is
+		// kept off the population's engine so validating never shifts a run.
+		std::uint64_t validationSeed = 0;
+		// Phase timings of the last completed generation; stays empty unless
+		// built with NEAT_DNFS_PROFILING.
+		tools::PhaseProfile phaseProfile{};
 
 		// Not thread-safe; only ever called from upkeep()/speciate(), both
 		// main-thread. Must not be called from the parallel evaluate() path.
@@ -186,6 +257,46 @@ namespace neat_dnfs
 		[[nodiscard]] const std::vector<Genome>& getBestSolutionGenomeHistory() const { return bestSolutionGenomeHistory; }
 
 		[[nodiscard]] const ValidationReport& getValidationReport() const { return validationReport; }
+		[[nodiscard]] const PerGenerationStatistics& getPerGenerationStatistics() const { return perGenStatistics; }
+		/// @return Time spent in each tools::Phase during the last completed
+		/// generation, on every thread. The profiler is process-wide, so
+		/// populations evolving concurrently see each other's phases.
+		[[nodiscard]] const tools::PhaseProfile& getPhaseProfile() const { return phaseProfile; }
+
+		/// @brief Writes everything evolve() carries from one generation to the
+		/// next: every solution's genome and evaluation results, the species,
+		/// the best-solution bookkeeping and histories, the fitness cache, the
+		/// global id and innovation counters and the population's random
+		/// engine (the seeded one, or the calling thread's). Call between
+		/// generations, i.e. not while evolve() runs on another thread.
+		void writeCheckpoint(std::ostream& out) const;
+		/// @brief Replaces this population's state with a checkpoint of a
+		/// population of the same task and size. Followed by evolve(), the run
+		/// continues exactly as the checkpointed one would have, provided
+		/// evaluation is deterministic and either serial or seeded (see
+		/// PopulationParameters::seed); unseeded parallel evaluation draws from
+		/// worker threads' engines, which aren't part of the checkpoint.
+		/// @throws std::runtime_error on a corrupt or truncated checkpoint, or
+		///         one of another task or population size.
+		void readCheckpoint(std::istream& in);
+		/// @brief writeCheckpoint() into @p filePath, replacing it atomically so
+		/// an interrupted write never leaves a partial checkpoint behind.
+		void saveCheckpoint(const std::string& filePath) const;
+		/// @brief readCheckpoint() from @p filePath.
+		/// @throws std::runtime_error if the file can't be opened.
+		void loadCheckpoint(const std::string& filePath);
+		/// @brief Loads the checkpoint of the run saved in @p directory; its
+		/// output files are then appended to instead of starting a new directory.
+		void resumeFrom(const std::string& directory);
+
+		/// @brief Replaces the pool used for parallel evaluation, e.g. to share one
+		/// long-lived pool across consecutive runs instead of each Population
+		/// creating its own.
+		void setExecutor(const std::shared_ptr<tools::ThreadPool>& pool) { executor = pool; }
+		/// @return The evaluation pool, or nullptr if none was injected and no
+		/// parallel evaluation has run yet.
+		[[nodiscard]] std::shared_ptr<tools::ThreadPool> getExecutor() const { return executor; }
+
 		void setValidationPolicy(ValidationPolicy policy) { validationPolicy = policy; }
 
 		/// Sets the ValidationPolicy every subsequently constructed Population
@@ -204,19 +315,41 @@ namespace neat_dnfs
 		void start() { control.stop = false; }
 	private:
 		static inline ValidationPolicy defaultValidationPolicy = ValidationPolicy::Log;
-		void evaluate() const;
+		void evaluate();
+		void evaluateSolutions(const std::vector<SolutionPtr>& pending);
+		void runEvaluations(const std::vector<SolutionPtr>& batch) const;
+		/// @brief solution->evaluate(), or solution->mutate(), drawing from the
+		/// solution's own stream in seeded mode.
+		void evaluateSolution(const SolutionPtr& solution) const;
+		void mutateSolution(const SolutionPtr& solution) const;
+		/// @return The engine the population's own draws come from: the seeded
+		/// one, or the calling thread's.
+		[[nodiscard]] tools::utils::Xoshiro256pp& randomEngine() const;
+		/// @return The tape this generation's evaluations share under
+		/// NoiseSource::GenerationTape, otherwise nullptr.
+		[[nodiscard]] std::shared_ptr<const tools::NoiseTape> makeGenerationNoiseTape() const;
+		void updateEarlyTerminationThreshold();
 		void speciate();
+		/// @param useExecutor  Precompute compatibility on the executor; false
+		///                     while the executor is busy evaluating, so the
+		///                     pass runs on the calling thread alone.
+		void assignSolutionsToSpecies(bool useExecutor);
 		void reproduceAndSelect();
 
 		[[nodiscard]] bool endConditionMet() const;
 
 		void startup();
 		void upkeep();
+		void checkpoint() const;
+		void collectPhaseProfile();
 		void cleanup();
 		void createInitialSolutions(const SolutionPtr& initialSolution);
 		void buildInitialSolutionsGenome() const;
 
 		void assignToSpecies(const SolutionPtr& solution);
+		/// @param isCompatible  Answers Species::isCompatible(solution) for the
+		///                      species at the given index of speciesList.
+		void assignToSpecies(const SolutionPtr& solution, const std::function<bool(size_t, const Species&)>& isCompatible);
 		std::shared_ptr<Species> findSpecies(const SolutionPtr& solution);
 		[[nodiscard]] std::shared_ptr<Species> getBestActiveSpecies() const;
 
@@ -238,11 +371,14 @@ namespace neat_dnfs
 		void upkeepChampions();
 		void upkeepPerGenerationStatistics();
 		void updateGenerationAndAges();
+		/// @return The ValidationMode in effect: Full under ValidationPolicy::Throw,
+		/// otherwise PopulationParameters::validationMode.
+		[[nodiscard]] ValidationMode activeValidationMode() const;
 		void validateElitism();
 		void validateUniqueSolutions();
 		void validatePopulationSize();
 		void validateUniqueGenesInGenomes();
-		void validateUniqueKernelAndNeuralFieldPtrs();
+		void validateUniqueGenesInGenome(const Solution& solution);
 		void validateIfSpeciesHaveUniqueRepresentative();
 		void validateAssignmentIntoSpecies();
 
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <dnf_composer/simulation/simulation_file_manager.h>
 
+#include "neat/solution.h"
+#include "neat_tools/async_writer.h"
+#include "neat_tools/telemetry.h"
+
 namespace neat_dnfs
 {
 	class Population;
@@ -14,6 +21,11 @@ namespace neat_dnfs
 	/// const getters. A Population that is constructed without a file manager performs
 	/// no file I/O at all (used by the unit tests). Each @c save* method honours the
 	/// corresponding @c PopulationConstants::saveXxx compile-time flag internally.
+	///
+	/// With @c PopulationConstants::asyncFileWrites the @c save* methods only
+	/// snapshot what they need on the calling thread (formatted text, detached
+	/// phenotype copies) and hand the disk writes to a background thread;
+	/// flush() waits for them.
 	class PopulationFileManager
 	{
 	public:
@@ -21,13 +33,31 @@ namespace neat_dnfs
 
 		/// @brief Builds the timestamped output directory for this run. Call once at startup.
 		void setFileDirectory();
+		/// @brief Writes into an existing run's directory instead, e.g. one
+		/// being resumed from its checkpoint.
+		/// @throws std::runtime_error if @p directory doesn't exist.
+		void setFileDirectory(const std::string& directory);
+		[[nodiscard]] bool hasFileDirectory() const { return !fileDirectory.empty(); }
 
-		/// @brief Writes the per-generation overview line. Called before generation/age updates.
+		/// @brief Writes the per-generation overview line and telemetry records. Called before generation/age updates.
 		void saveOverviewForGeneration() const;
 		/// @brief Writes the remaining per-generation artifacts. Called after generation/age updates.
 		void savePerGenerationData() const;
 		/// @brief Writes end-of-run artifacts (final solutions, timestamps, champions).
 		void saveEndOfRunData() const;
+		/// @brief Replaces the run's checkpoint with one of the population's
+		/// current state. The state is captured on the calling thread.
+		void saveCheckpoint() const;
+		/// @brief Appends the phase timings of the generation that just ended
+		/// (see Population::getPhaseProfile()) to phase_times.txt and
+		/// telemetry_phases.bin.
+		void savePhaseProfile() const;
+		/// @brief Writes every phase traced during the run to phase_trace.json,
+		/// for chrome://tracing or ui.perfetto.dev.
+		void savePhaseTrace() const;
+		/// @brief Blocks until every write queued so far is on disk.
+		/// @throws The first exception raised by a background write since the last flush().
+		void flush() const;
 
 	private:
 		void saveAllSolutionsWithFitnessAbove(double fitness) const;
@@ -35,12 +65,27 @@ namespace neat_dnfs
 		void saveTimestampsAndDuration() const;
 		void saveAllSolutionsPerGeneration() const;
 		void savePerGenerationOverview() const;
+		void saveGenerationTelemetry() const;
+		void saveSpeciesTelemetry() const;
+		void openTelemetry();
+		void flushTelemetry() const;
+		void appendTelemetry(const std::shared_ptr<tools::TelemetryWriter>& telemetry, std::vector<tools::TelemetryValue> row) const;
 		void saveBestSolutionOfEachGeneration() const;
 		void saveChampionsOfEachGeneration() const;
 		void savePerGenerationStatistics() const;
 		void savePerGenerationSpecies() const;
 
+		void savePhenotype(const SolutionPtr& solution, const std::string& directoryPath, bool saveWeights) const;
+		void appendToFile(const std::string& filePath, std::string contents, const std::string& errorMessage) const;
+		void write(std::function<void()> job) const;
+
 		const Population* population;
 		std::string fileDirectory;
+		// Only touched by write jobs once opened; declared before the writer
+		// so its queued jobs finish before they close.
+		std::shared_ptr<tools::TelemetryWriter> generationTelemetry;
+		std::shared_ptr<tools::TelemetryWriter> speciesTelemetry;
+		std::shared_ptr<tools::TelemetryWriter> phaseTelemetry;
+		std::unique_ptr<tools::AsyncWriter> writer;
 	};
 }
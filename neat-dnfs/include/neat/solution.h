@@ -1,12 +1,17 @@
 #pragma once
 
+#include "field_snapshot.h"
 #include "genome.h"
+#include <cstdint>
 #include <format>
+#include <functional>
+#include <limits>
 #include <optional>
 
 namespace neat_dnfs
 {
 	class Solution;
+	namespace test { class SolutionTestAccess; }
 	using PhenotypePtr = std::shared_ptr<dnf_composer::Simulation>;
 	using SolutionPtr = std::shared_ptr<Solution>;
 
@@ -30,6 +35,14 @@ namespace neat_dnfs
 		double adjustedFitness;
 		int age;
 		int speciesId{-1};
+		/// Set when testPhenotype() stopped early because the evaluation could
+		/// no longer reach its early-termination threshold; fitness and
+		/// partialFitness then only cover the phases that ran.
+		bool evaluationTruncated{false};
+		/// Simulation steps runSimulation() skipped in the last evaluation
+		/// because the fields had reached a steady state
+		/// (see SimulationConstants::adaptiveStepping).
+		int savedSimulationSteps{0};
 		std::vector<double> partialFitness;
 		std::vector<dnf_composer::element::NeuralFieldBump> bumps;
 
@@ -69,6 +82,60 @@ namespace neat_dnfs
 		}
 	};
 
+	/// @brief A neural field of a solution's built phenotype, resolved once by
+	/// name (Solution::fieldHandle()) so fitness helpers and stepping loops
+	/// reach the field by index instead of looking its name up on every call.
+	///
+	/// Valid until the phenotype is cleared or rebuilt; a handle used after
+	/// that makes the solution throw std::logic_error. Patching a persistent
+	/// phenotype keeps its handles valid.
+	class FieldHandle
+	{
+		friend class Solution;
+		friend class TrialSnapshots;
+	private:
+		size_t index = 0;
+		std::uint64_t build = 0;
+
+		FieldHandle(size_t index, std::uint64_t build) : index(index), build(build) {}
+	public:
+		FieldHandle() = default;
+	};
+
+	/// @brief Every field of the phenotype a trial phase ran on, snapshotted
+	/// once the phase finished (see Solution::runTrials()).
+	class TrialSnapshots
+	{
+		friend class Solution;
+	private:
+		std::vector<FieldSnapshot> snapshots;	// indexed like the solution's resolved fields
+	public:
+		[[nodiscard]] const FieldSnapshot& operator[](const FieldHandle field) const { return snapshots.at(field.index); }
+	};
+
+	/// @brief A Gauss stimulus a trial phase applies to one field.
+	struct TrialStimulus
+	{
+		FieldHandle field;
+		dnf_composer::element::GaussStimulusParameters parameters;
+	};
+
+	/// @brief One condition of a trial: the stimuli it applies in place of
+	/// the previous phase's, how long it runs for and the partial fitness
+	/// terms it scores the fields on afterwards. The scorer may run on any
+	/// thread and only sees snapshots, so it scores with the FieldSnapshot
+	/// overloads of the fitness helpers.
+	struct TrialPhase
+	{
+		std::vector<TrialStimulus> stimuli;
+		int iterations = SimulationConstants::maxSimulationSteps;
+		std::function<std::vector<double>(const TrialSnapshots&)> score;
+	};
+
+	/// @brief Phases run back to back from a phenotype at rest, sharing
+	/// nothing with the task's other trials.
+	using Trial = std::vector<TrialPhase>;
+
 	/// @brief Abstract base class for all NEAT-evolved solutions.
 	///
 	/// Subclasses must implement:
@@ -78,8 +145,16 @@ namespace neat_dnfs
 	///
 	/// The fitness value set in @c testPhenotype() drives species assignment,
 	/// adjusted-fitness calculation, and offspring allocation.
+	///
+	/// Multi-phase tasks can opt into early termination: declare the weight of
+	/// every partial fitness term with @c declarePartialFitnessWeights(), record
+	/// each term with @c recordPartialFitness(), and return from
+	/// @c testPhenotype() when @c continueEvaluation() is false between phases.
 	class Solution : public std::enable_shared_from_this<Solution>
 	{
+		// Test-only accessor for stubs that edit the genome in place -- see
+		// tests/test_solution_access.h.
+		friend class test::SolutionTestAccess;
 	protected:
 		static inline int uniqueIdentifierCounter = 0;
 		int id;
@@ -89,6 +164,43 @@ namespace neat_dnfs
 		dnf_composer::Simulation phenotype;
 		Genome genome;
 		std::tuple <int, int> parents;
+	private:
+		/// @brief Structural fingerprint of a built phenotype: which field genes
+		/// exist with which self-kernel type, and which coupling kernels (by
+		/// element name, which encodes kernel type, tuple and innovation number)
+		/// are wired in. Parameter-only mutations leave it unchanged and can be
+		/// patched in place; anything else forces a rebuild.
+		struct PhenotypeLayout
+		{
+			std::vector<std::pair<int, dnf_composer::element::ElementLabel>> fieldKernels;
+			std::vector<std::string> couplings;
+
+			bool operator==(const PhenotypeLayout& other) const = default;
+		};
+		PhenotypeLayout phenotypeLayout;
+		bool phenotypeBuilt = false;
+		bool phenotypeInSyncWithGenome = false;
+		std::vector<double> partialFitnessWeights;
+		double earlyTerminationThreshold = -std::numeric_limits<double>::infinity();
+		std::shared_ptr<const tools::NoiseTape> noiseTape;
+		bool phenotypeReadsNoiseTape = false;
+		/// The phenotype's neural fields in genome order, which a FieldHandle
+		/// indexes.
+		std::vector<NeuralFieldPtr> resolvedFields;
+		/// Bumped whenever the phenotype is built or cleared, invalidating
+		/// every FieldHandle resolved before.
+		std::uint64_t phenotypeBuildCount = 0;
+		/// Bumped whenever the phenotype steps or is reinitialized, so a field
+		/// snapshot knows whether it still shows the field.
+		std::uint64_t phenotypeStep = 0;
+		struct CachedFieldSnapshot
+		{
+			std::uint64_t step = std::numeric_limits<std::uint64_t>::max();
+			FieldSnapshot snapshot;
+		};
+		/// Indexed like resolvedFields. Filled lazily by getFieldSnapshot(),
+		/// which the (const) fitness helpers call.
+		mutable std::vector<CachedFieldSnapshot> fieldSnapshots;
 	public:
 		virtual ~Solution() = default;
 
@@ -103,6 +215,7 @@ namespace neat_dnfs
 		void setSpeciesId(int speciesId);
 		void setParents(int parent1, int parent2);
 		[[nodiscard]] int getSpeciesId() const { return parameters.speciesId; }
+		[[nodiscard]] int getAge() const { return parameters.age; }
 		[[nodiscard]] std::tuple<int, int> getParents() const { return parents; }
 		/// @return A const reference to this solution's phenotype simulation.
 		[[nodiscard]] const dnf_composer::Simulation& getPhenotype() const;
@@ -123,8 +236,36 @@ namespace neat_dnfs
 		static void clearGenerationalInnovations();
 		void incrementAge();
 		void setAdjustedFitness(double adjustedFitness);
+		/// @brief Overwrites fitness and partial fitness with a previously computed
+		/// result, e.g. one restored from the population's FitnessCache.
+		/// @param truncated  Whether that result came from a truncated evaluation
+		///                   (see SolutionParameters::evaluationTruncated).
+		void setEvaluationResult(double fitness, const std::vector<double>& partialFitness, bool truncated = false);
+		/// @brief Fitness the next evaluate() has to be able to reach; a task
+		/// using declarePartialFitnessWeights() stops as soon as it can't.
+		/// Defaults to -infinity, i.e. never stop early.
+		void setEarlyTerminationThreshold(double threshold) { earlyTerminationThreshold = threshold; }
+		[[nodiscard]] double getEarlyTerminationThreshold() const { return earlyTerminationThreshold; }
+		/// @brief Tape the field noise of the next evaluate() reads from (see
+		/// TapeNoise); nullptr, the default, draws independent noise.
+		void setNoiseTape(std::shared_ptr<const tools::NoiseTape> tape) { noiseTape = std::move(tape); }
+		[[nodiscard]] const std::shared_ptr<const tools::NoiseTape>& getNoiseTape() const { return noiseTape; }
+		/// @return The highest fitness the current evaluation can still reach:
+		/// the weighted terms recorded so far plus the full weight of every term
+		/// not recorded yet (partial fitness terms are assumed to lie in [0, 1]).
+		[[nodiscard]] double getFitnessUpperBound() const;
+		/// @brief Builds the phenotype from the genome, clearing any phenotype
+		/// that is still alive from a previous build or evaluation first.
 		void buildPhenotype();
 		void clearPhenotype();
+		/// @brief Builds a separate simulation from the genome, with the task's
+		/// environment (createPhenotypeEnvironment()) wired in, for saving.
+		/// The live phenotype and its resolved fields are left alone,
+		/// so exporting doesn't cost the next evaluation a rebuild.
+		[[nodiscard]] dnf_composer::Simulation exportPhenotype();
+		/// @return True if a phenotype is currently built and kept alive
+		/// (see SolutionConstants::persistentPhenotype).
+		[[nodiscard]] bool hasPhenotype() const { return phenotypeBuilt; }
 		void addFieldGene(const FieldGene& gene);
 		void addConnectionGene(const ConnectionGene& gene);
 		[[nodiscard]] bool containsConnectionGene(const ConnectionGene& gene) const;
@@ -136,10 +277,31 @@ namespace neat_dnfs
 		void print() const;
 		virtual void createPhenotypeEnvironment() = 0;
 		static void resetUniqueIdentifier();
+		/// @brief The id the next solution will get; saved and restored with
+		/// checkpoints so a resumed run numbers its solutions identically.
+		[[nodiscard]] static int getUniqueIdentifierCounter() { return uniqueIdentifierCounter; }
+		static void setUniqueIdentifierCounter(int counter) { uniqueIdentifierCounter = counter; }
 		void translatePhenotypeToGenome();
 		void clearGenome();
 		void clearLastMutations();
+		/// @brief Puts a solution that is no longer referenced back into the
+		/// state of a freshly constructed one for @p topology (new id, no
+		/// fitness, empty genome and phenotype), keeping the genome's storage.
+		/// Used by SolutionPool; tasks that add state of their own override it
+		/// and call the base version.
+		/// @throws std::invalid_argument if @p topology lacks inputs or outputs.
+		virtual void reinitialize(const SolutionTopology& topology);
+		/// @brief Writes the id, evaluation results, age, species, parents and
+		/// genome, for checkpoints. The phenotype is rebuilt from the genome.
+		void serialize(tools::BinaryWriter& writer) const;
+		/// @brief Takes over the state serialize() wrote, keeping this
+		/// solution's task and topology; any live phenotype is cleared.
+		/// @throws std::runtime_error on corrupt or truncated data.
+		void deserialize(tools::BinaryReader& reader);
 	private:
+		static void validateTopology(const SolutionTopology& topology);
+		/// @brief Marks the live phenotype as out of date after a genome change.
+		void invalidatePhenotype();
 		void createInputGenes();
 		void createOutputGenes();
 		/// @brief Ablation seeding: adds AblationConstants::seedHiddenFieldsMin..Max
@@ -151,10 +313,33 @@ namespace neat_dnfs
 		void createSeededConnectionGenes();
 		void translateGenesToPhenotype();
 		void translateConnectionGenesToPhenotype();
+		/// @brief Makes the phenotype match the genome before testPhenotype():
+		/// reuses a live phenotype as-is, patches it if only gene parameters
+		/// changed, or (re)builds it if the layout changed or none exists.
+		void preparePhenotypeForEvaluation();
+		/// @brief Copies the parameters of every gene mutated since the last build
+		/// onto its live neural field, self-kernel or coupling kernel.
+		/// @return False if a mutated gene's kernel can't be patched in place.
+		bool patchPhenotype();
+		/// @brief Points every TapeNoise of a live phenotype at the current
+		/// tape, back at its first step.
+		void rewindNoiseTape();
+		[[nodiscard]] PhenotypeLayout computePhenotypeLayout() const;
+		/// @brief Advances the simulation one step.
+		void stepPhenotype();
+		/// @brief Runs @p trial on the phenotype itself.
+		/// @return The trial's partial fitness terms, in phase order.
+		std::vector<double> runTrial(const Trial& trial);
+		/// @brief Fills resolvedFields from the freshly built phenotype.
+		void resolveFields();
+		/// @throws std::logic_error if @p field was resolved on a phenotype
+		///         that has since been cleared or rebuilt.
+		[[nodiscard]] const NeuralFieldPtr& resolvedField(FieldHandle field) const;
+		[[nodiscard]] bool fieldHasBumps(FieldHandle field) const;
 		/// @brief Casts the named phenotype element to a NeuralField, or throws
 		/// std::invalid_argument if it doesn't exist or isn't a NeuralField --
-		/// fitness helpers are always called with field names from the
-		/// solution's own topology, so a miss means a genuine configuration bug.
+		/// fields are always resolved with names from the solution's own
+		/// topology, so a miss means a genuine configuration bug.
 		/// @param fieldName   Unique name of the phenotype element to look up.
 		/// @param callerName  Name of the calling fitness helper, included in the
 		///                    exception message to identify which computation failed.
@@ -163,18 +348,6 @@ namespace neat_dnfs
 		///         the phenotype, or if it exists but isn't a NeuralField.
 		std::shared_ptr<dnf_composer::element::NeuralField> getNeuralFieldOrThrow(const std::string& fieldName, const std::string& callerName) const;
 
-		/// @brief Converts a spatial position into a valid index into @p neuralField's
-		/// component vectors (e.g. "activation"), clamping to the field's sample range.
-		/// @details Positions passed to fitness helpers come from genome-derived
-		/// stimulus parameters and task definitions, and can legitimately fall on or
-		/// beyond a field's upper spatial bound (e.g. position == field size * d_x,
-		/// the field's own extent). Clamping keeps component lookups well-defined at
-		/// that boundary instead of indexing past the end of the underlying buffer.
-		/// @param neuralField  Field whose spatial resolution (d_x) and sample count bound the index.
-		/// @param position     Spatial position to convert.
-		/// @return An index in [0, neuralField->getSize() - 1].
-		static int clampedIndexForPosition(const std::shared_ptr<dnf_composer::element::NeuralField>& neuralField, double position);
-
 		/// @brief Finds the bump in @p candidates closest to @p targetPosition and
 		/// removes it from @p candidates.
 		/// @details Used by the multi-bump fitness helpers to match target positions
@@ -192,42 +365,107 @@ namespace neat_dnfs
 		/// @brief Run the simulation and write the result into @c parameters.fitness. Called by @c evaluate().
 		virtual void testPhenotype() = 0;
 
+		/// @brief Starts a phase-aware evaluation: resets fitness and partial
+		/// fitness and declares the weight of every term the task will record,
+		/// in recording order. Fitness becomes the weighted sum of the terms.
+		void declarePartialFitnessWeights(std::vector<double> weights);
+		/// @brief Records the next partial fitness term, expected in [0, 1], and
+		/// adds its weighted value to @c parameters.fitness.
+		/// @throws std::logic_error if more terms are recorded than were declared.
+		void recordPartialFitness(double value);
+		/// @brief Checked between phases of testPhenotype().
+		/// @return False, marking the evaluation as truncated, once
+		/// getFitnessUpperBound() is below the early-termination threshold;
+		/// testPhenotype() should then return without running further phases.
+		[[nodiscard]] bool continueEvaluation();
+
+		/// @brief Runs independent trials one after the other on the phenotype
+		/// and collects their partial fitness. Each trial starts from rest,
+		/// with the noise tape (if any) rewound.
+		/// @return Every trial's terms, in trial then phase order.
+		std::vector<double> runTrials(const std::vector<Trial>& trials);
+
 		void initSimulation();
 		void stopSimulation();
+		/// @brief Steps the phenotype @p iterations times, or fewer under
+		/// SimulationConstants::adaptiveStepping once every neural field is at
+		/// a fixed point; the skipped steps add to
+		/// SolutionParameters::savedSimulationSteps.
 		void runSimulation(int iterations);
 		void addGaussianStimulus(const std::string& targetElement,
 			const dnf_composer::element::GaussStimulusParameters& stimulusParameters,
 			const dnf_composer::element::ElementDimensions& dimensions
 		);
+		void addGaussianStimulus(FieldHandle target,
+			const dnf_composer::element::GaussStimulusParameters& stimulusParameters,
+			const dnf_composer::element::ElementDimensions& dimensions
+		);
 		void removeGaussianStimuli();
 		void removeGaussianStimuliFromField(const std::string& fieldName);
 		void setGaussianStimulusParameters(const std::string& stimulusName, const dnf_composer::element::GaussStimulusParameters& parameters) const;
+
+		/// @brief Resolves a field of the built phenotype for the helpers below.
+		/// Resolve the fields a task reads once per testPhenotype() rather
+		/// than passing their names to every helper call.
+		/// @throws std::invalid_argument if the phenotype has no neural field
+		///         named @p fieldName (@p callerName prefixes the message).
+		[[nodiscard]] FieldHandle fieldHandle(const std::string& fieldName, const std::string& callerName = "fieldHandle") const;
+
 		/// @brief Fitness score in [0,1] reflecting how close the field activity is to its resting level (no bump).
-		double closenessToRestingLevel(const std::string& fieldName) const;
+		double closenessToRestingLevel(FieldHandle field) const;
 		/// @brief Returns 1.0 if the field has no active bump, 0.0 otherwise.
-		double noBumps(const std::string& fieldName) const;
+		double noBumps(FieldHandle field) const;
 		/// @brief Fitness score that rewards forming a bump within @p targetIterations; penalises exceeding @p maxIterations.
-		double iterationsUntilBump(const std::string& fieldName, double targetIterations, double maxIterations, double tolerance);
+		double iterationsUntilBump(FieldHandle field, double targetIterations, double maxIterations, double tolerance);
 		/// @brief Fitness score that rewards losing a bump within @p targetIterations; penalises exceeding @p maxIterations.
-		double iterationsUntilNoBump(const std::string& fieldName, double targetIterations, double maxIterations, double tolerance);
+		double iterationsUntilNoBump(FieldHandle field, double targetIterations, double maxIterations, double tolerance);
 
 		// validated but could be improved
-		double oneBumpAtPositionWithAmplitudeAndWidth(const std::string& fieldName,
+		double oneBumpAtPositionWithAmplitudeAndWidth(FieldHandle field,
 			const double& position, const double& amplitude, const double& width) const;
-		double twoBumpsAtPositionWithAmplitudeAndWidth(const std::string& fieldName,
+		double twoBumpsAtPositionWithAmplitudeAndWidth(FieldHandle field,
 						const double& position1, const double& amplitude1, const double& width1,
 						const double& position2, const double& amplitude2, const double& width2) const;
-		double threeBumpsAtPositionWithAmplitudeAndWidth(const std::string& fieldName,
+		double threeBumpsAtPositionWithAmplitudeAndWidth(FieldHandle field,
 									const double& position1, const double& amplitude1, const double& width1,
 									const double& position2, const double& amplitude2, const double& width2,
 									const double& position3, const double& amplitude3, const double& width3) const;
-		double preShapednessAtPosition(const std::string& fieldName, double position ) const;
-		double negativePreShapednessAtPosition(const std::string& fieldName, const double& position) const;
-		double justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(const std::string& fieldName,
+		double preShapednessAtPosition(FieldHandle field, double position ) const;
+		double negativePreShapednessAtPosition(FieldHandle field, const double& position) const;
+		double justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(FieldHandle field,
 		                                                                    const std::vector<double>& positions, const double& amplitude, const double& width) const;
+		double negativeBaseline(FieldHandle field) const;
 
+		/// @name Snapshot helpers
+		/// What the FieldHandle overloads compute, on a snapshot already taken
+		/// (e.g. in a TrialPhase scorer).
+		/// @{
+		static double closenessToRestingLevel(const FieldSnapshot& snapshot);
+		static double noBumps(const FieldSnapshot& snapshot);
+		static double oneBumpAtPositionWithAmplitudeAndWidth(const FieldSnapshot& snapshot,
+			const double& position, const double& amplitude, const double& width);
+		static double twoBumpsAtPositionWithAmplitudeAndWidth(const FieldSnapshot& snapshot,
+						const double& position1, const double& amplitude1, const double& width1,
+						const double& position2, const double& amplitude2, const double& width2);
+		static double threeBumpsAtPositionWithAmplitudeAndWidth(const FieldSnapshot& snapshot,
+									const double& position1, const double& amplitude1, const double& width1,
+									const double& position2, const double& amplitude2, const double& width2,
+									const double& position3, const double& amplitude3, const double& width3);
+		static double preShapednessAtPosition(const FieldSnapshot& snapshot, double position);
+		static double negativePreShapednessAtPosition(const FieldSnapshot& snapshot, const double& position);
+		static double justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(const FieldSnapshot& snapshot,
+		                                                                            const std::vector<double>& positions, const double& amplitude, const double& width);
+		static double negativeBaseline(const FieldSnapshot& snapshot);
+		/// @}
 
 		void moveGaussianStimulusContinuously(const std::string& name, double targetPosition, double step);
-		double negativeBaseline(const std::string& fieldName) const;
+
+		/// @brief What the fitness helpers read of a field, taken from the
+		/// phenotype's NeuralField, bumps included: those are
+		/// NeuralField::getBumps(), as the exported phenotype reports them.
+		/// Taken once per field between steps, so helpers scoring the same
+		/// checkpoint share one pass.
+		/// @return A snapshot that is only current until the phenotype steps.
+		[[nodiscard]] const FieldSnapshot& getFieldSnapshot(FieldHandle field) const;
 	};
 }
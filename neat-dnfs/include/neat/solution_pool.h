@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "solution.h"
+
+namespace neat_dnfs
+{
+	/// @brief Recycles solutions that are no longer referenced into the next
+	/// ones a task creates.
+	///
+	/// Every generation crossover() clones roughly a population's worth of
+	/// solutions and the previous generation is dropped wholesale once the
+	/// offspring replace it. Solutions created with make() don't go back to
+	/// the allocator when their last SolutionPtr goes away: they are parked,
+	/// per concrete type, and the next make() for that type reinitializes one
+	/// in place (Solution::reinitialize()). Its gene vectors keep their
+	/// capacity, so a week-long run settles on a fixed set of allocations for
+	/// solutions and genomes instead of churning through the allocator each
+	/// generation.
+	///
+	/// Thread-safe: the last reference to a solution may be dropped on any
+	/// thread. Deleters keep the pool alive, so solutions can outlive
+	/// instance()'s static. At most getCapacity() solutions of each type are
+	/// parked; any beyond that are freed.
+	class SolutionPool
+	{
+	private:
+		mutable std::mutex mutex;
+		std::unordered_map<std::type_index, std::vector<std::unique_ptr<Solution>>> idle;
+		size_t capacity = SolutionConstants::poolCapacity;
+		size_t created = 0;
+		size_t recycled = 0;
+	public:
+		/// @return The pool shared by the whole process.
+		static const std::shared_ptr<SolutionPool>& instance();
+
+		/// @brief Creates a T for @p topology, reusing a parked T if there is one.
+		/// @tparam T  A concrete (final) Solution type constructible from a SolutionTopology.
+		template <typename T>
+		static SolutionPtr make(const SolutionTopology& topology)
+		{
+			static_assert(std::is_base_of_v<Solution, T> && std::is_final_v<T>,
+				"SolutionPool parks solutions by their concrete type.");
+
+			std::shared_ptr<SolutionPool> pool = instance();
+			std::unique_ptr<Solution> solution = pool->take(typeid(T));
+			if (solution)
+			{
+				solution->reinitialize(topology);
+			}
+			else
+			{
+				solution = std::make_unique<T>(topology);
+			}
+			return { solution.release(), [pool](Solution* released) { pool->release(released); } };
+		}
+
+		void setCapacity(size_t capacity);
+		[[nodiscard]] size_t getCapacity() const;
+		/// @return Solutions currently parked, over all types.
+		[[nodiscard]] size_t getIdle() const;
+		/// @return Solutions make() had to allocate.
+		[[nodiscard]] size_t getCreated() const;
+		/// @return Solutions make() served from the pool.
+		[[nodiscard]] size_t getRecycled() const;
+		/// @brief Frees every parked solution and resets the counters.
+		void clear();
+	private:
+		std::unique_ptr<Solution> take(std::type_index type);
+		void release(Solution* solution);
+	};
+}
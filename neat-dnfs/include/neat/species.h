@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 #include "solution.h"
 
@@ -37,6 +38,7 @@ namespace neat_dnfs
         [[nodiscard]] int getId() const;
         [[nodiscard]] double totalAdjustedFitness() const;
         [[nodiscard]] int getOffspringCount() const;
+        [[nodiscard]] int getAge() const { return age; }
         [[nodiscard]] std::vector<SolutionPtr> getMembers() const;
         [[nodiscard]] bool isExtinct() const;
         [[nodiscard]] bool hasFitnessImprovedOverTheLastGenerations() const;
@@ -53,6 +55,8 @@ namespace neat_dnfs
         {
 			currentSpeciesId = 0;
         }
+        [[nodiscard]] static int getUniqueIdentifierCounter() { return currentSpeciesId; }
+        static void setUniqueIdentifierCounter(int counter) { currentSpeciesId = counter; }
 
         void addSolution(const SolutionPtr& solution);
         void removeSolution(const SolutionPtr& solution);
@@ -70,5 +74,14 @@ namespace neat_dnfs
 
         [[nodiscard]] std::string toString() const;
         void print() const;
+
+        /// @brief Writes the species' state between generations, for
+        /// checkpoints. Solutions are shared with the population, so they are
+        /// written as the index @p indexOf gives them (-1 for none).
+        void serialize(tools::BinaryWriter& writer, const std::function<std::int32_t(const SolutionPtr&)>& indexOf) const;
+        /// @brief Rebuilds a species serialize() wrote, resolving solution
+        /// indices into @p solutions. Doesn't advance the species id counter.
+        /// @throws std::runtime_error on an index outside @p solutions or truncated data.
+        [[nodiscard]] static std::shared_ptr<Species> deserialize(tools::BinaryReader& reader, const std::vector<SolutionPtr>& solutions);
     };
 }
\ No newline at end of file
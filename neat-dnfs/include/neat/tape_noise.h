@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+
+#include <elements/element_factory.h>
+
+#include "neat_tools/noise_tape.h"
+
+namespace neat_dnfs
+{
+	/// @brief NormalNoise element that reads its draws from a shared NoiseTape
+	/// instead of drawing them each step.
+	///
+	/// Built by FieldGene::getNoise() when a solution evaluates against a tape,
+	/// with the field gene id as the tape lane, so the same field of every
+	/// individual sees the same noise. It still is a NormalNoise with the same
+	/// parameters, so everything that looks noise elements up, exports or
+	/// patches them treats it like one.
+	class TapeNoise : public dnf_composer::element::NormalNoise
+	{
+	private:
+		std::shared_ptr<const tools::NoiseTape> tape;
+		size_t lane;
+		size_t stepIndex = 0;
+	public:
+		TapeNoise(const dnf_composer::element::ElementCommonParameters& elementCommonParameters,
+			const dnf_composer::element::NormalNoiseParameters& parameters,
+			std::shared_ptr<const tools::NoiseTape> tape, size_t lane);
+
+		/// @throws std::runtime_error if the tape is narrower than the element.
+		void step(double t, double deltaT) override;
+		[[nodiscard]] std::shared_ptr<dnf_composer::element::Element> clone() const override;
+
+		/// @brief Reads from @p tape from its first step on. Steps are counted
+		/// across init() calls, so consecutive trials of one evaluation don't
+		/// replay the same noise.
+		void setTape(std::shared_ptr<const tools::NoiseTape> tape);
+		[[nodiscard]] const std::shared_ptr<const tools::NoiseTape>& getTape() const { return tape; }
+		[[nodiscard]] size_t getLane() const { return lane; }
+	};
+}
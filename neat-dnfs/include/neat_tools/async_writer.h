@@ -0,0 +1,50 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		/// @brief Runs I/O jobs in FIFO order on one background thread.
+		///
+		/// Used by PopulationFileManager so writing a generation's files to disk
+		/// overlaps with reproduction and the next evaluation instead of stalling
+		/// the evolution loop. Jobs must own (or share ownership of) everything
+		/// they touch; the caller decides when the data they read may be modified
+		/// again by calling flush().
+		class AsyncWriter
+		{
+		private:
+			std::deque<std::function<void()>> jobs;
+			std::mutex mutex;
+			std::condition_variable jobAvailable;
+			std::condition_variable drained;
+			std::exception_ptr firstError;
+			bool busy = false;
+			bool stopping = false;
+			std::thread thread;
+		public:
+			AsyncWriter();
+			/// @brief Finishes every queued job before returning. Errors still
+			/// pending at this point are logged, not thrown.
+			~AsyncWriter();
+			AsyncWriter(const AsyncWriter&) = delete;
+			AsyncWriter(AsyncWriter&&) = delete;
+			AsyncWriter& operator=(const AsyncWriter&) = delete;
+			AsyncWriter& operator=(AsyncWriter&&) = delete;
+
+			void enqueue(std::function<void()> job);
+			/// @brief Blocks until every job enqueued so far has run.
+			/// @throws The first exception thrown by a job since the last flush().
+			void flush();
+		private:
+			void run();
+		};
+	}
+}
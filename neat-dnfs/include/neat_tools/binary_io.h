@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		/// @brief Writes values to a stream as raw bytes, for checkpoints.
+		///
+		/// Values are written in host byte order and layout: a checkpoint is
+		/// meant to be read back by the same build on the same kind of machine,
+		/// not to be exchanged. Strings and vectors are prefixed with their
+		/// size as a 64-bit integer.
+		class BinaryWriter
+		{
+		private:
+			std::ostream& out;
+		public:
+			explicit BinaryWriter(std::ostream& out) : out(out) {}
+
+			template <typename T>
+			void write(const T& value)
+			{
+				static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are written as raw bytes.");
+				out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+			}
+
+			template <typename T>
+			void writeVector(const std::vector<T>& values)
+			{
+				static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are written as raw bytes.");
+				write(static_cast<std::uint64_t>(values.size()));
+				out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+			}
+
+			void writeString(const std::string& value);
+		};
+
+		/// @brief Reads back what a BinaryWriter wrote.
+		/// @throws std::runtime_error from every read once the stream runs out,
+		///         or on a size prefix too large to be genuine.
+		class BinaryReader
+		{
+		private:
+			std::istream& in;
+		public:
+			static constexpr std::uint64_t maxSequenceBytes = std::uint64_t{ 1 } << 32;
+
+			explicit BinaryReader(std::istream& in) : in(in) {}
+
+			template <typename T>
+			T read()
+			{
+				static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are read as raw bytes.");
+				T value;
+				readBytes(reinterpret_cast<char*>(&value), sizeof(T));
+				return value;
+			}
+
+			template <typename T>
+			std::vector<T> readVector()
+			{
+				static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are read as raw bytes.");
+				std::vector<T> values(readSequenceSize(sizeof(T)));
+				readBytes(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+				return values;
+			}
+
+			std::string readString();
+			/// @return A size prefix, checked against maxSequenceBytes for
+			///         elements of @p elementSize bytes.
+			size_t readSequenceSize(size_t elementSize);
+		private:
+			void readBytes(char* destination, size_t count);
+		};
+
+		/// @brief Writes @p contents to "<filePath>.tmp" and renames it over
+		/// @p filePath, so readers only ever see the previous or the new file.
+		/// @throws std::runtime_error if the temporary file can't be written;
+		///         std::filesystem::filesystem_error if the rename fails.
+		void writeFileAtomically(const std::string& filePath, const std::string& contents);
+	}
+}
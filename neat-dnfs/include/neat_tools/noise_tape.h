@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		/// @brief Pre-generated standard normal draws shared read-only by every
+		/// evaluation of a generation (common random numbers).
+		///
+		/// The tape holds numSteps rows of width samples. A noise source reads
+		/// row(step, lane)[x] where lane identifies it (e.g. a field gene id):
+		/// lanes start at different rows and walk the tape from there, wrapping
+		/// around, so two fields of one phenotype get unrelated noise while the
+		/// same field of two individuals gets the same. Individuals are then
+		/// compared on the same noise realization, and the inner loop reads a
+		/// buffer instead of drawing from an engine.
+		///
+		/// Immutable once built; share it by std::shared_ptr<const NoiseTape>.
+		class NoiseTape
+		{
+		private:
+			size_t numSteps;
+			size_t width;
+			std::uint64_t seed;
+			std::vector<double> samples;	// [row * width + x]
+		public:
+			/// @throws std::invalid_argument if @p numSteps or @p width is zero.
+			NoiseTape(size_t numSteps, size_t width, std::uint64_t seed);
+
+			/// @return The width draws @p lane reads at @p step.
+			[[nodiscard]] std::span<const double> row(size_t step, size_t lane) const;
+
+			[[nodiscard]] size_t getNumSteps() const { return numSteps; }
+			[[nodiscard]] size_t getWidth() const { return width; }
+			[[nodiscard]] std::uint64_t getSeed() const { return seed; }
+		};
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+// Set by the NEAT_DNFS_PROFILING CMake option. Off, NEAT_DNFS_PROFILE_PHASE
+// expands to nothing and the hot paths carry no timers at all.
+#ifndef NEAT_DNFS_PROFILING
+#define NEAT_DNFS_PROFILING 0
+#endif
+
+#define NEAT_DNFS_PROFILE_CONCAT_INNER(a, b) a##b
+#define NEAT_DNFS_PROFILE_CONCAT(a, b) NEAT_DNFS_PROFILE_CONCAT_INNER(a, b)
+#if NEAT_DNFS_PROFILING
+/// Times the rest of the enclosing scope as one occurrence of @p phase.
+#define NEAT_DNFS_PROFILE_PHASE(phase) \
+	const ::neat_dnfs::tools::ScopedPhaseTimer NEAT_DNFS_PROFILE_CONCAT(scopedPhaseTimer, __LINE__)(phase)
+#else
+#define NEAT_DNFS_PROFILE_PHASE(phase) static_cast<void>(0)
+#endif
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		inline constexpr bool profilingEnabled = NEAT_DNFS_PROFILING != 0;
+
+		/// @brief Stages of a generation the profiler times. Phases nest (a
+		/// rebuild clears the old phenotype first, evaluate() contains every
+		/// build, test and clear), so their totals overlap.
+		enum class Phase
+		{
+			Evaluate,
+			BuildPhenotype,
+			TestPhenotype,
+			ClearPhenotype,
+			Speciate,
+			Upkeep,
+			Validation,
+			FileIO,
+			ReproduceAndSelect,
+			Count
+		};
+
+		[[nodiscard]] std::string_view phaseName(Phase phase);
+
+		/// @brief Durations of one phase, bucketed by powers of two.
+		struct PhaseHistogram
+		{
+			/// Bucket i counts durations in [2^i, 2^(i+1)) microseconds; bucket 0
+			/// also takes everything under a microsecond, the last everything above.
+			static constexpr size_t numBuckets = 32;
+
+			std::uint64_t count = 0;
+			std::uint64_t totalNanoseconds = 0;
+			std::uint64_t minNanoseconds = 0;
+			std::uint64_t maxNanoseconds = 0;
+			std::array<std::uint64_t, numBuckets> buckets{};
+
+			void add(std::uint64_t nanoseconds);
+			/// @return An upper bound on the @p quantile (in [0, 1]) duration, in
+			///         nanoseconds: the top of the bucket it falls in, capped at
+			///         the longest duration seen. 0 if nothing was recorded.
+			[[nodiscard]] std::uint64_t quantileNanoseconds(double quantile) const;
+			[[nodiscard]] double meanNanoseconds() const;
+		};
+		using PhaseProfile = std::array<PhaseHistogram, static_cast<size_t>(Phase::Count)>;
+
+		/// @brief Process-wide collector of phase timings.
+		///
+		/// Each thread appends to a buffer of its own, so timers on evaluation
+		/// workers never contend with each other; the buffer's lock is only
+		/// shared with collect(). collect() drains every buffer into a
+		/// histogram per phase and, while tracing, keeps the raw events for
+		/// writeChromeTrace().
+		class Profiler
+		{
+		public:
+			using Clock = std::chrono::steady_clock;
+		private:
+			struct Event
+			{
+				Phase phase;
+				std::uint32_t thread;
+				std::int64_t startNanoseconds;	// since the profiler's epoch
+				std::int64_t durationNanoseconds;
+			};
+			struct ThreadBuffer
+			{
+				std::mutex mutex;
+				std::vector<Event> events;
+				std::uint32_t thread = 0;
+			};
+
+			Clock::time_point epoch = Clock::now();
+			mutable std::mutex mutex;	// guards buffers, trace, tracing and nextThread
+			std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+			std::vector<Event> trace;
+			bool tracing = false;
+			std::uint32_t nextThread = 0;
+		public:
+			static Profiler& instance();
+
+			void record(Phase phase, Clock::time_point start, Clock::time_point end);
+			/// @return Every duration recorded since the last collect().
+			PhaseProfile collect();
+
+			/// @brief Keeps the events collect() drains for writeChromeTrace().
+			void setTracing(bool enabled);
+			[[nodiscard]] bool isTracing() const;
+			/// @brief Writes the kept events in Chrome's trace event format, which
+			/// chrome://tracing and ui.perfetto.dev open: one complete ("X") event
+			/// per timed scope, one track per thread.
+			void writeChromeTrace(std::ostream& out) const;
+			void clearTrace();
+		private:
+			Profiler() = default;
+			ThreadBuffer& threadBuffer();
+		};
+
+		/// @brief Records the lifetime of the object as one occurrence of a
+		/// phase; use through NEAT_DNFS_PROFILE_PHASE.
+		class ScopedPhaseTimer
+		{
+		private:
+			Phase phase;
+			Profiler::Clock::time_point start;
+		public:
+			explicit ScopedPhaseTimer(Phase phase);
+			~ScopedPhaseTimer();
+			ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+			ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+		};
+	}
+}
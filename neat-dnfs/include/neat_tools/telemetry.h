@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <istream>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		enum class TelemetryColumnType : std::uint8_t
+		{
+			Int64 = 0,
+			Float64 = 1
+		};
+
+		struct TelemetryColumn
+		{
+			std::string name;
+			TelemetryColumnType type;
+
+			bool operator==(const TelemetryColumn&) const = default;
+		};
+
+		/// @brief One cell of a telemetry record, converted to its column's
+		/// type when appended.
+		class TelemetryValue
+		{
+		private:
+			std::variant<std::int64_t, double> value;
+		public:
+			template <std::integral T>
+			TelemetryValue(T value) : value(static_cast<std::int64_t>(value)) {}
+			template <std::floating_point T>
+			TelemetryValue(T value) : value(static_cast<double>(value)) {}
+
+			/// @return The 8 bytes stored for this value in a column of @p type.
+			[[nodiscard]] std::uint64_t encode(TelemetryColumnType type) const;
+		};
+
+		/// @brief Appends fixed-schema records to a binary file it keeps open.
+		///
+		/// The file starts with a header (magic, version, then the type and
+		/// name of every column) followed by batches: a 64-bit row count, then
+		/// each column's values back to back as 8-byte integers or doubles, in
+		/// host byte order. Rows are buffered and written one batch at a time,
+		/// so the file only ever grows by whole batches; analysis/viz/telemetry.py
+		/// reads it into columns without any parsing.
+		///
+		/// Not thread-safe: PopulationFileManager only touches a writer from
+		/// its background write jobs.
+		class TelemetryWriter
+		{
+		public:
+			static constexpr std::array<char, 8> magic{ 'N', 'D', 'T', 'E', 'L', 'E', 'M', '1' };
+			static constexpr std::uint32_t version = 1;
+		private:
+			std::string filePath;
+			std::vector<TelemetryColumn> schema;
+			size_t batchRows;
+			std::vector<std::vector<std::uint64_t>> columns;	// buffered rows, one vector per column
+			std::ofstream file;
+		public:
+			/// @brief Opens @p filePath, writing the header if the file is new
+			/// or empty. An existing file is appended to, after dropping a batch
+			/// an interrupted run left incomplete.
+			/// @throws std::runtime_error if the file can't be opened, or holds
+			///         a different schema or isn't a telemetry file.
+			TelemetryWriter(std::string filePath, std::vector<TelemetryColumn> schema, size_t batchRows);
+			/// @brief Writes the rows still buffered; errors are logged, not thrown.
+			~TelemetryWriter();
+			TelemetryWriter(const TelemetryWriter&) = delete;
+			TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+			/// @brief Buffers one record, writing the batch once it holds batchRows.
+			/// @throws std::invalid_argument if @p row doesn't have one value per column.
+			void append(std::span<const TelemetryValue> row);
+			void append(std::initializer_list<TelemetryValue> row) { append(std::span(row.begin(), row.size())); }
+			/// @brief Writes the buffered rows as a batch and flushes the file.
+			/// @throws std::runtime_error if the write fails.
+			void flush();
+
+			[[nodiscard]] const std::vector<TelemetryColumn>& getSchema() const { return schema; }
+			[[nodiscard]] size_t getBufferedRows() const { return columns.empty() ? 0 : columns.front().size(); }
+		};
+
+		/// @brief A telemetry file read back whole, column by column.
+		struct TelemetryTable
+		{
+			std::vector<TelemetryColumn> schema;
+			std::vector<std::vector<std::uint64_t>> columns;	// raw 8-byte values
+
+			[[nodiscard]] size_t numRows() const { return columns.empty() ? 0 : columns.front().size(); }
+			/// @throws std::out_of_range for an unknown column name.
+			[[nodiscard]] size_t columnIndex(const std::string& name) const;
+			[[nodiscard]] std::int64_t int64At(const std::string& column, size_t row) const;
+			[[nodiscard]] double float64At(const std::string& column, size_t row) const;
+		};
+
+		/// @brief Reads a telemetry file's header.
+		/// @throws std::runtime_error if @p in isn't a telemetry file.
+		[[nodiscard]] std::vector<TelemetryColumn> readTelemetrySchema(std::istream& in);
+		/// @brief Reads every complete batch; an incomplete last batch is ignored.
+		/// @throws std::runtime_error if @p in isn't a telemetry file.
+		[[nodiscard]] TelemetryTable readTelemetry(std::istream& in);
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		class ThreadPool;
+
+		/// @brief A batch of tasks submitted to a ThreadPool that can be waited on
+		/// as a unit. Only the first exception thrown by any of its tasks is kept
+		/// and rethrown by ThreadPool::wait(); the remaining tasks still run.
+		class TaskGroup
+		{
+			friend class ThreadPool;
+		private:
+			std::atomic<size_t> pending{ 0 };
+			std::mutex errorMutex;
+			std::exception_ptr firstError;
+		public:
+			TaskGroup() = default;
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup& operator=(const TaskGroup&) = delete;
+
+			[[nodiscard]] bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+		};
+
+		/// @brief Snapshot of one worker's load, see ThreadPool::getWorkerStatistics().
+		struct WorkerStatistics
+		{
+			size_t queueDepth = 0;			///< Tasks currently waiting in the worker's own deque.
+			size_t peakQueueDepth = 0;		///< Largest queue depth observed since the last reset.
+			size_t tasksExecuted = 0;		///< Tasks run by this worker, stolen ones included.
+			size_t tasksStolen = 0;			///< Tasks this worker took from another worker's deque.
+			std::chrono::nanoseconds idleTime{ 0 };	///< Time spent asleep waiting for work.
+		};
+
+		/// @brief Long-lived work-stealing thread pool.
+		///
+		/// Each worker owns a deque: it pushes and pops its own work at the back
+		/// (LIFO, cache-warm) and, when that runs dry, steals from the front of the
+		/// others' deques. Work submitted from outside the pool is spread over the
+		/// workers round-robin. The threads live as long as the pool, so a
+		/// Population (or a whole sequence of runs sharing one pool) pays the
+		/// thread creation cost once instead of once per generation.
+		///
+		/// wait() called from a worker thread keeps executing pending tasks while
+		/// it waits, so tasks may themselves submit and wait on nested groups
+		/// without deadlocking. A thread outside the pool just blocks, which keeps
+		/// the number of concurrently running tasks bounded by size().
+		class ThreadPool
+		{
+		private:
+			struct Task
+			{
+				std::function<void()> work;
+				TaskGroup* group;
+			};
+
+			struct Worker
+			{
+				std::mutex mutex;
+				std::deque<Task> deque;
+				std::thread thread;
+				std::atomic<size_t> peakQueueDepth{ 0 };
+				std::atomic<size_t> tasksExecuted{ 0 };
+				std::atomic<size_t> tasksStolen{ 0 };
+				std::atomic<long long> idleNanoseconds{ 0 };
+			};
+
+			std::vector<std::unique_ptr<Worker>> workers;
+			std::atomic<size_t> queuedTasks{ 0 };
+			std::atomic<size_t> nextWorker{ 0 };
+			std::atomic<bool> stopping{ false };
+			std::mutex sleepMutex;
+			std::condition_variable workAvailable;
+			std::condition_variable taskCompleted;
+			bool pinThreads;
+		public:
+			/// @param numWorkers  Number of worker threads; 0 uses std::thread::hardware_concurrency().
+			/// @param pinThreads  Pin worker i to logical CPU i (mod the CPU count). Only
+			///                    supported on Linux; elsewhere it's logged and ignored.
+			explicit ThreadPool(size_t numWorkers = 0, bool pinThreads = false);
+			~ThreadPool();
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool(ThreadPool&&) = delete;
+			ThreadPool& operator=(const ThreadPool&) = delete;
+			ThreadPool& operator=(ThreadPool&&) = delete;
+
+			void submit(TaskGroup& group, std::function<void()> work);
+			/// @brief Blocks until every task of @p group has finished.
+			/// @throws The first exception thrown by any task of @p group.
+			void wait(TaskGroup& group);
+			/// @brief Runs @p body(i) for every i in [0, count) on the pool and waits.
+			/// @throws The first exception thrown by any invocation of @p body.
+			void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+			[[nodiscard]] size_t size() const { return workers.size(); }
+			/// @return True if the calling thread is one of this pool's workers.
+			[[nodiscard]] bool isWorkerThread() const;
+			[[nodiscard]] std::vector<WorkerStatistics> getWorkerStatistics() const;
+			void resetStatistics();
+		private:
+			void workerLoop(size_t index);
+			void pinCurrentThread(size_t index) const;
+			bool tryRunOne(size_t self);
+			void run(Task& task);
+			void notifyCompletion();
+		};
+	}
+}
@@ -16,6 +16,7 @@
 #undef ERROR
 #endif
 
+#include <array>
 #include <iostream>
 #include <random>
 #include <cstdint>
@@ -23,6 +24,8 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <initializer_list>
+#include <utility>
 
 namespace neat_dnfs
 {
@@ -47,6 +50,7 @@ namespace neat_dnfs
             {
             public:
                 using result_type = std::uint64_t;
+                using State = std::array<std::uint64_t, 4>;
 
                 explicit Xoshiro256pp(const std::uint64_t seed)
                 {
@@ -73,6 +77,14 @@ namespace neat_dnfs
                     return result;
                 }
 
+                // The full state, so a checkpointed run can continue the same stream.
+                [[nodiscard]] State getState() const { return { s[0], s[1], s[2], s[3] }; }
+                void setState(const State& state)
+                {
+                    for (size_t i = 0; i < state.size(); ++i)
+                        s[i] = state[i];
+                }
+
             private:
                 std::uint64_t s[4]{};
             };
@@ -95,13 +107,39 @@ namespace neat_dnfs
                     ^ time ^ (sequence * 0xBF58476D1CE4E5B9ULL);
             }
 
-            // One engine per thread, constructed once and reused for every draw.
+            // Engine a ScopedEngine installed on the calling thread, if any.
+            inline Xoshiro256pp*& scopedEngine()
+            {
+                thread_local Xoshiro256pp* installed = nullptr;
+                return installed;
+            }
+
+            // One engine per thread, constructed once and reused for every draw,
+            // unless a ScopedEngine currently stands in for it.
             inline Xoshiro256pp& engine()
             {
                 thread_local Xoshiro256pp gen{ makeThreadSeed() };
-                return gen;
+                Xoshiro256pp* installed = scopedEngine();
+                return installed != nullptr ? *installed : gen;
             }
 
+            // Makes every draw on the calling thread come from `engine` for as
+            // long as it lives, e.g. a stream seeded per solution so a seeded run
+            // doesn't depend on which worker thread did what. Scopes nest.
+            class ScopedEngine
+            {
+            public:
+                explicit ScopedEngine(Xoshiro256pp& engine)
+                    : previous(std::exchange(scopedEngine(), &engine))
+                {}
+                ~ScopedEngine() { scopedEngine() = previous; }
+                ScopedEngine(const ScopedEngine&) = delete;
+                ScopedEngine& operator=(const ScopedEngine&) = delete;
+
+            private:
+                Xoshiro256pp* previous;
+            };
+
             inline int generateRandomInt(const int min, const int max)
             {
                 std::uniform_int_distribution<int> dist(min, max);
@@ -152,6 +190,34 @@ namespace neat_dnfs
                 return dist(engine()) ? 1 : -1; // Randomly selects -1 or 1 with equal probability
             }
 
+            // Folds one 64-bit word into a running content hash. Each word goes
+            // through splitmix64's finalizer, so nearby values (e.g. two kernel
+            // widths one mutation step apart) still land far apart.
+            inline void hashCombine(std::uint64_t& hash, std::uint64_t value)
+            {
+                std::uint64_t state = hash ^ value;
+                hash = splitmix64(state) + std::rotl(hash, 7);
+            }
+
+            // Hashes the exact bit pattern, so only bit-identical doubles collide;
+            // -0.0 is folded onto 0.0 so they don't hash apart.
+            inline void hashCombine(std::uint64_t& hash, const double value)
+            {
+                hashCombine(hash, std::bit_cast<std::uint64_t>(value == 0.0 ? 0.0 : value));
+            }
+
+            // Seed of the stream a run seed assigns to `key` (e.g. generation and
+            // solution id): a pure function of its arguments, so the stream is the
+            // same whichever thread asks for it, and distinct keys get unrelated
+            // streams once Xoshiro256pp spreads the seed through splitmix64.
+            inline std::uint64_t streamSeed(const std::uint64_t seed, const std::initializer_list<std::uint64_t> key)
+            {
+                std::uint64_t hash = seed;
+                for (const std::uint64_t word : key)
+                    hashCombine(hash, word);
+                return hash;
+            }
+
 		}
 	}
 }
\ No newline at end of file
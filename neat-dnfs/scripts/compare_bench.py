@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""
+Compare two neat-dnfs-bench JSON reports benchmark by benchmark
+
+Usage:
+    neat-dnfs-bench --benchmark_out=before.json --benchmark_out_format=json
+    # ... change the code, rebuild ...
+    neat-dnfs-bench --benchmark_out=after.json --benchmark_out_format=json
+    python compare_bench.py before.json after.json --threshold 5
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(path):
+    """Map benchmark name -> (real time, time unit), skipping aggregates"""
+    with open(path, encoding="utf-8") as file:
+        report = json.load(file)
+    times = {}
+    for benchmark in report["benchmarks"]:
+        if benchmark.get("run_type") == "aggregate":
+            continue
+        times[benchmark["name"]] = (benchmark["real_time"], benchmark["time_unit"])
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="percent change above which a benchmark is flagged (default: 5)")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline)
+    contender = load_times(args.contender)
+
+    width = max((len(name) for name in baseline), default=10)
+    print(f"{'benchmark':<{width}}  {'baseline':>14}  {'contender':>14}  {'change':>8}")
+    regressions = 0
+    for name, (before, unit) in baseline.items():
+        if name not in contender:
+            print(f"{name:<{width}}  {before:>11.3f} {unit:<2}  {'missing':>14}")
+            continue
+        after, _ = contender[name]
+        change = (after - before) / before * 100.0 if before else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  slower"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  faster"
+        print(f"{name:<{width}}  {before:>11.3f} {unit:<2}  {after:>11.3f} {unit:<2}  {change:>+7.1f}%{flag}")
+    for name in contender.keys() - baseline.keys():
+        print(f"{name:<{width}}  {'new':>14}")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
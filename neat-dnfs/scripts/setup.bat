@@ -29,6 +29,7 @@ echo Installing vcpkg packages...
     "nlohmann-json:x64-windows" ^
     "catch2:x64-windows" ^
     "gtest:x64-windows" ^
+    "benchmark:x64-windows" ^
     "fftw3:x64-windows"
 if errorlevel 1 ( echo ERROR: vcpkg install failed. & exit /b 1 )
 
@@ -38,6 +38,7 @@ echo "Installing vcpkg packages..."
     "nlohmann-json:$TRIPLET" \
     "catch2:$TRIPLET" \
     "gtest:$TRIPLET" \
+    "benchmark:$TRIPLET" \
     "fftw3:$TRIPLET"
 
 # ── imgui-platform-kit ────────────────────────────────────────────────────────
@@ -58,97 +58,40 @@ namespace neat_dnfs
 	}
 
 	ConnectionGene::ConnectionGene(const ConnectionTuple connectionTuple, const int innov)
-		: parameters(connectionTuple, innov)
-	{
-		initializeKernel(dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-	}
+		: parameters(connectionTuple, innov), kernelParameters(makeKernelParameters())
+	{}
 
 	ConnectionGene::ConnectionGene(const ConnectionTuple connectionTuple, const int innov,
 		const dnf_composer::element::GaussKernelParameters& gkp)
-		: parameters(connectionTuple, innov)
-	{
-		using namespace dnf_composer::element;
-
-		const std::string elementName = std::format("{}{}-{} {}",
-			GaussKernelConstants::namePrefixConnectionGene,
-			connectionTuple.inFieldGeneId,
-			connectionTuple.outFieldGeneId,
-			innov);
-		const ElementCommonParameters gkcp{ elementName,
-			dnf_composer::element::ElementDimensions{DimensionConstants::xSize, DimensionConstants::dx} };
-		kernel = std::make_unique<GaussKernel>(gkcp, gkp);
-	}
+		: parameters(connectionTuple, innov), kernelParameters(gkp)
+	{}
 
 	ConnectionGene::ConnectionGene(const ConnectionTuple connectionTuple, const int innov,
 		const dnf_composer::element::MexicanHatKernelParameters& mhkp)
-		: parameters(connectionTuple, innov)
-	{
-		using namespace dnf_composer::element;
+		: parameters(connectionTuple, innov), kernelParameters(mhkp)
+	{}
 
-		const std::string elementName = std::format("{}{}-{} {}",
-			MexicanHatKernelConstants::namePrefixConnectionGene,
-			connectionTuple.inFieldGeneId,
-			connectionTuple.outFieldGeneId,
-			innov);
-		const ElementCommonParameters mhkcp{ elementName,
-			dnf_composer::element::ElementDimensions{DimensionConstants::xSize, DimensionConstants::dx} };
-		kernel = std::make_unique<MexicanHatKernel>(mhkcp, mhkp);
-	}
+	ConnectionGene::ConnectionGene(const ConnectionTuple connectionTuple, const int innov,
+		const KernelParameters& kernelParameters)
+		: parameters(connectionTuple, innov), kernelParameters(kernelParameters)
+	{}
 
 	ConnectionGene::ConnectionGene(const ConnectionGeneParameters& parameters,
 		const dnf_composer::element::GaussKernelParameters& gkp)
-		: parameters(parameters)
-	{
-		using namespace dnf_composer::element;
-
-		const std::string elementName = std::format("{}{}-{} {}",
-			GaussKernelConstants::namePrefixConnectionGene,
-			parameters.connectionTuple.inFieldGeneId,
-			parameters.connectionTuple.outFieldGeneId,
-			parameters.innovationNumber);
-		const ElementCommonParameters gkcp{ elementName,
-			dnf_composer::element::ElementDimensions{DimensionConstants::xSize, DimensionConstants::dx} };
-		kernel = std::make_unique<GaussKernel>(gkcp, gkp);
-	}
+		: parameters(parameters), kernelParameters(gkp)
+	{}
 
 	ConnectionGene::ConnectionGene(const ConnectionGeneParameters& parameters,
 				const dnf_composer::element::MexicanHatKernelParameters& mhkp)
-		: parameters(parameters)
-	{
-		using namespace dnf_composer::element;
-
-		const std::string elementName = std::format("{}{}-{} {}",
-			MexicanHatKernelConstants::namePrefixConnectionGene,
-			parameters.connectionTuple.inFieldGeneId,
-			parameters.connectionTuple.outFieldGeneId,
-			parameters.innovationNumber);
-		const ElementCommonParameters mhkcp{ elementName,
-					dnf_composer::element::ElementDimensions{DimensionConstants::xSize, DimensionConstants::dx} };
-		kernel = std::make_unique<MexicanHatKernel>(mhkcp, mhkp);
-	}
+		: parameters(parameters), kernelParameters(mhkp)
+	{}
 
-	ConnectionGene::ConnectionGene(const ConnectionTuple connectionTuple, const int innov, KernelPtr kernel)
-		: parameters(connectionTuple, innov), kernel(std::move(kernel))
-	{
-		if (!kernel)
-		{
-			throw std::invalid_argument("Cannot create ConnectionGene with null kernel");
-		}
-	}
+	ConnectionGene::ConnectionGene(const ConnectionTuple connectionTuple, const int innov, const KernelPtr& kernel)
+		: parameters(connectionTuple, innov), kernelParameters(kernelParametersOf(kernel))
+	{}
 
 	void ConnectionGene::mutate()
 	{
-		using namespace dnf_composer::element;
-
-		if (!kernel)
-		{
-			const std::string message = std::format("Calling mutate() on ConnectionGene with ConnectionTuple: {}-{} but kernel is nullptr.",
-                                                parameters.connectionTuple.inFieldGeneId,
-                                                parameters.connectionTuple.outFieldGeneId);
-			tools::logger::log(tools::logger::FATAL, message);
-			throw std::runtime_error(message);
-		}
-
 		static constexpr double totalProbability = ConnectionGeneConstants::mutateConnectionGeneKernelProbability +
 			ConnectionGeneConstants::mutateConnectionGeneConnectionSignalProbability +
 			ConnectionGeneConstants::mutateConnectionGeneKernelTypeProbability;
@@ -210,9 +153,37 @@ namespace neat_dnfs
 		return mutationsInLastGeneration;
 	}
 
+	std::string ConnectionGene::getKernelName() const
+	{
+		using namespace dnf_composer::element;
+
+		std::string_view prefix;
+		switch (getKernelLabel())
+		{
+		case GAUSS_KERNEL:
+			prefix = GaussKernelConstants::namePrefixConnectionGene;
+			break;
+		case MEXICAN_HAT_KERNEL:
+			prefix = MexicanHatKernelConstants::namePrefixConnectionGene;
+			break;
+		default:
+			prefix = OscillatoryKernelConstants::namePrefixConnectionGene;
+			break;
+		}
+		return std::format("{}{}-{} {}",
+			prefix,
+			parameters.connectionTuple.inFieldGeneId,
+			parameters.connectionTuple.outFieldGeneId,
+			parameters.innovationNumber);
+	}
+
 	KernelPtr ConnectionGene::getKernel() const
 	{
-		return kernel;
+		using namespace dnf_composer::element;
+
+		const ElementCommonParameters commonParameters{ getKernelName(),
+			ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx } };
+		return makeKernel(commonParameters, kernelParameters);
 	}
 
 	int ConnectionGene::getInnovationNumber() const
@@ -233,35 +204,29 @@ namespace neat_dnfs
 	double ConnectionGene::getKernelAmplitude() const
 	{
 		using namespace dnf_composer::element;
-		switch (kernel->getLabel())
+		switch (getKernelLabel())
 		{
 			case GAUSS_KERNEL:
-				return std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters().amplitude;
+				return std::get<GaussKernelParameters>(kernelParameters).amplitude;
 			case MEXICAN_HAT_KERNEL:
-				return std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters().amplitudeExc;
-			case OSCILLATORY_KERNEL:
-				return std::dynamic_pointer_cast<OscillatoryKernel>(kernel)->getParameters().amplitude;
+				return std::get<MexicanHatKernelParameters>(kernelParameters).amplitudeExc;
 			default:
-				break;
+				return std::get<OscillatoryKernelParameters>(kernelParameters).amplitude;
 		}
-		throw std::runtime_error("ConnectionGene::getKernelAmplitude() - Kernel type not recognized.");
 	}
 
 	double ConnectionGene::getKernelWidth() const
 	{
 		using namespace dnf_composer::element;
-		switch (kernel->getLabel())
+		switch (getKernelLabel())
 		{
 			case GAUSS_KERNEL:
-				return std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters().width;
+				return std::get<GaussKernelParameters>(kernelParameters).width;
 			case MEXICAN_HAT_KERNEL:
-				return std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters().widthExc;
-			case OSCILLATORY_KERNEL:
-				return std::dynamic_pointer_cast<OscillatoryKernel>(kernel)->getParameters().decay;
+				return std::get<MexicanHatKernelParameters>(kernelParameters).widthExc;
 			default:
-				break;
+				return std::get<OscillatoryKernelParameters>(kernelParameters).decay;
 		}
-		throw std::runtime_error("ConnectionGene::getKernelWidth() - Kernel type not recognized.");
 	}
 
 	bool ConnectionGene::operator==(const ConnectionGene& other) const
@@ -271,10 +236,7 @@ namespace neat_dnfs
 
 	bool ConnectionGene::isCloneOf(const ConnectionGene& other) const
 	{
-		using namespace dnf_composer::element;
-
-		const auto k_other = other.getKernel();
-		return parameters == other.parameters && kernel == k_other;
+		return parameters == other.parameters && sameKernelParameters(kernelParameters, other.kernelParameters);
 	}
 
 	std::string ConnectionGene::toString() const
@@ -293,22 +255,34 @@ namespace neat_dnfs
 
 	ConnectionGene ConnectionGene::clone() const
 	{
-		using namespace dnf_composer::element;
+		ConnectionGene clone{ *this };
+		clone.clearLastMutations();
+		return clone;
+	}
 
-		switch (kernel->getLabel())
-		{
-			case GAUSS_KERNEL:
-				return ConnectionGene{ parameters, std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters() };
-			case MEXICAN_HAT_KERNEL:
-				return ConnectionGene{ parameters, std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters() };
-			default:
-				break;
-		}
+	void ConnectionGene::serialize(tools::BinaryWriter& writer) const
+	{
+		writer.write(static_cast<std::int32_t>(parameters.connectionTuple.inFieldGeneId));
+		writer.write(static_cast<std::int32_t>(parameters.connectionTuple.outFieldGeneId));
+		writer.write(static_cast<std::int32_t>(parameters.innovationNumber));
+		writer.write(parameters.enabled);
+		serializeKernelParameters(writer, kernelParameters);
+		writer.writeString(mutationsInLastGeneration);
+	}
 
-		throw std::runtime_error("ConnectionGene::clone() - Kernel type not recognized.");
+	ConnectionGene ConnectionGene::deserialize(tools::BinaryReader& reader)
+	{
+		const int inFieldGeneId = reader.read<std::int32_t>();
+		const int outFieldGeneId = reader.read<std::int32_t>();
+		const int innov = reader.read<std::int32_t>();
+		const bool enabled = reader.read<bool>();
+		ConnectionGene gene{ ConnectionTuple{ inFieldGeneId, outFieldGeneId }, innov, deserializeKernelParameters(reader) };
+		gene.parameters.enabled = enabled;
+		gene.mutationsInLastGeneration = reader.readString();
+		return gene;
 	}
 
-	void ConnectionGene::initializeKernel(const dnf_composer::element::ElementDimensions& dimensions)
+	KernelParameters ConnectionGene::makeKernelParameters()
 	{
 		using namespace neat_dnfs::tools::utils;
 
@@ -324,15 +298,12 @@ namespace neat_dnfs
 		const double randomValue = generateRandomDouble(0.0, 1.0);
 		if (randomValue < ConnectionGeneConstants::gaussKernelProbability)
 		{
-			initializeGaussKernel(dimensions);
-		}
-		else
-		{
-			initializeMexicanHatKernel(dimensions);
+			return makeGaussKernelParameters();
 		}
+		return makeMexicanHatKernelParameters();
 	}
 
-	void ConnectionGene::initializeGaussKernel(const dnf_composer::element::ElementDimensions& dimensions)
+	dnf_composer::element::GaussKernelParameters ConnectionGene::makeGaussKernelParameters()
 	{
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
@@ -341,22 +312,15 @@ namespace neat_dnfs
 		const double width = generateRandomDouble(GaussKernelConstants::widthMinVal, GaussKernelConstants::widthMaxVal);
 		const double amplitude = amplitude_sign * generateRandomDouble(GaussKernelConstants::ampMinVal, GaussKernelConstants::ampMaxVal);
 		constexpr double amplitudeGlobal = 0.0;
-		const GaussKernelParameters gkp{ width,
+		return GaussKernelParameters{ width,
 										amplitude,
 											amplitudeGlobal,
 									KernelConstants::circularity,
 									KernelConstants::normalization
 		};
-		const std::string elementName = std::format("{}{}-{} {}",
-                                                GaussKernelConstants::namePrefixConnectionGene,
-                                                parameters.connectionTuple.inFieldGeneId,
-                                                parameters.connectionTuple.outFieldGeneId,
-                                                parameters.innovationNumber);
-		const ElementCommonParameters gkcp{ elementName, dimensions };
-		kernel = std::make_shared<GaussKernel>(gkcp, gkp);
 	}
 
-	void ConnectionGene::initializeMexicanHatKernel(const dnf_composer::element::ElementDimensions& dimensions)
+	dnf_composer::element::MexicanHatKernelParameters ConnectionGene::makeMexicanHatKernelParameters()
 	{
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
@@ -367,7 +331,7 @@ namespace neat_dnfs
 		const double widthInh = generateRandomDouble(MexicanHatKernelConstants::widthInhMinVal, MexicanHatKernelConstants::widthInhMaxVal);
 		const double amplitudeInh = generateRandomDouble(MexicanHatKernelConstants::ampInhMinVal, MexicanHatKernelConstants::ampInhMaxVal);
 		constexpr double amplitudeGlobal = 0.0;
-		const MexicanHatKernelParameters mhkp{ widthExc,
+		return MexicanHatKernelParameters{ widthExc,
 								amplitudeExc,
 								widthInh,
 								amplitudeInh,
@@ -375,18 +339,11 @@ namespace neat_dnfs
 								KernelConstants::circularity,
 								KernelConstants::normalization
 		};
-		const std::string elementName = std::format("{}{}-{} {}",
-                                                MexicanHatKernelConstants::namePrefixConnectionGene,
-                                                parameters.connectionTuple.inFieldGeneId,
-                                                parameters.connectionTuple.outFieldGeneId,
-                                                parameters.innovationNumber);
-		const ElementCommonParameters mhcp{ elementName, dimensions};
-		kernel = std::make_shared<MexicanHatKernel>(mhcp, mhkp);
 	}
 
 	void ConnectionGene::mutateKernel()
 	{
-		switch (kernel->getLabel())
+		switch (getKernelLabel())
 		{
 		case dnf_composer::element::ElementLabel::GAUSS_KERNEL:
 			mutateGaussKernel();
@@ -405,8 +362,6 @@ namespace neat_dnfs
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
 
-		const auto dimensions = kernel->getElementCommonParameters().dimensionParameters;
-
 		constexpr double totalProbability = FieldGeneConstants::gaussKernelProbability +
 			FieldGeneConstants::mexicanHatKernelProbability;
 
@@ -420,12 +375,12 @@ namespace neat_dnfs
 
 		if (randomValue < FieldGeneConstants::gaussKernelProbability)
 		{
-			initializeGaussKernel(dimensions);
+			kernelParameters = makeGaussKernelParameters();
 			mutationsInLastGeneration += "(cg to gk)";
 		}
 		else
 		{
-			initializeMexicanHatKernel(dimensions);
+			kernelParameters = makeMexicanHatKernelParameters();
 			mutationsInLastGeneration += "(cg to mhk)";
 		}
 	}
@@ -437,8 +392,7 @@ namespace neat_dnfs
 
 		const int signal = generateRandomSignal(); // +/- to add or sum a step
 
-		const auto gaussKernel = std::dynamic_pointer_cast<GaussKernel>(kernel);
-		GaussKernelParameters gkp = std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters();
+		auto& gkp = std::get<GaussKernelParameters>(kernelParameters);
 		const int amp_sign = gkp.amplitude < 0 ? -1 : 1;
 
 		if (generateRandomDouble(0.0, 1.0) < ConnectionGeneConstants::mutateConnectionGeneGaussKernelWidthProbability)
@@ -464,7 +418,6 @@ namespace neat_dnfs
 				GaussKernelConstants::ampGlobalMaxVal);
 			mutationsInLastGeneration += std::format("(cg gk amp. glob. {})", GaussKernelConstants::ampGlobalStep * signal);
 		}
-		std::dynamic_pointer_cast<GaussKernel>(kernel)->setParameters(gkp);
 	}
 
 	void ConnectionGene::mutateMexicanHatKernel()
@@ -474,8 +427,7 @@ namespace neat_dnfs
 
 		const int signal = generateRandomSignal();  // +/- to add or sum a step
 
-		const auto mexicanHatKernel = std::dynamic_pointer_cast<MexicanHatKernel>(kernel);
-		MexicanHatKernelParameters mhkp = std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters();
+		auto& mhkp = std::get<MexicanHatKernelParameters>(kernelParameters);
 		const int amp_sign = mhkp.amplitudeExc < 0 ? -1 : 1;
 
 		if (generateRandomDouble(0.0, 1.0) < ConnectionGeneConstants::mutateConnectionGeneMexicanHatKernelAmplitudeExcProbability)
@@ -517,31 +469,26 @@ namespace neat_dnfs
 				MexicanHatKernelConstants::ampGlobMax);
 			mutationsInLastGeneration += std::format("(cg mhk amp. glob. {})", MexicanHatKernelConstants::ampGlobStep * signal);
 		}
-		std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->setParameters(mhkp);
 	}
 
 	void ConnectionGene::mutateConnectionSignal()
 	{
 		using namespace dnf_composer::element;
 
-		switch (kernel->getLabel())
+		switch (getKernelLabel())
 		{
 		case GAUSS_KERNEL:
 			{
-				const auto gaussKernel = std::dynamic_pointer_cast<GaussKernel>(kernel);
-				GaussKernelParameters gkp = std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters();
+				auto& gkp = std::get<GaussKernelParameters>(kernelParameters);
 				gkp.amplitude = -gkp.amplitude;
-				gaussKernel->setParameters(gkp);
 				const bool amp_sign = gkp.amplitude >= 0;
 				mutationsInLastGeneration += std::format("(cg to {})", amp_sign ? "excitatory" : "inhibitory");
 			}
 			break;
 		case MEXICAN_HAT_KERNEL:
 			{
-				const auto mexicanHatKernel = std::dynamic_pointer_cast<MexicanHatKernel>(kernel);
-				MexicanHatKernelParameters mhkp = std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters();
+				auto& mhkp = std::get<MexicanHatKernelParameters>(kernelParameters);
 				mhkp.amplitudeExc = -mhkp.amplitudeExc;
-				mexicanHatKernel->setParameters(mhkp);
 				const bool amp_sign = mhkp.amplitudeExc >=0;
 				mutationsInLastGeneration += std::format("(cg to {})", amp_sign ? "excitatory" : "inhibitory");
 			}
@@ -36,88 +36,63 @@ namespace neat_dnfs
 	}
 
 	FieldGene::FieldGene(const FieldGeneParameters& parameters, const dnf_composer::element::ElementDimensions& dimensions)
-		: parameters(parameters)
-	{
-		switch (parameters.type)
-		{
-		case FieldGeneType::INPUT:
-			setAsInput(dimensions);
-			break;
-		case FieldGeneType::OUTPUT:
-			setAsOutput(dimensions);
-			break;
-		case FieldGeneType::HIDDEN:
-			setAsHidden(dimensions);
-			break;
-		}
-	}
+		: parameters(parameters),
+		dimensions(dimensions),
+		neuralFieldParameters(makeNeuralFieldParameters()),
+		kernelParameters(makeKernelParameters()),
+		noiseParameters(makeNoiseParameters())
+	{}
 
-	FieldGene::FieldGene(const FieldGeneParameters& parameters, const NeuralFieldPtr& neuralField, KernelPtr kernel)
-		: parameters(parameters), neuralField(neuralField), kernel(std::move(kernel))
-	{
-		initializeNoise(neuralField->getElementCommonParameters().dimensionParameters);
-	}
+	FieldGene::FieldGene(const FieldGeneParameters& parameters, const NeuralFieldPtr& neuralField, const KernelPtr& kernel)
+		: parameters(parameters),
+		dimensions(neuralField->getElementCommonParameters().dimensionParameters),
+		neuralFieldParameters(neuralField->getParameters()),
+		kernelParameters(kernelParametersOf(kernel)),
+		noiseParameters(makeNoiseParameters())
+	{}
 
 	FieldGene::FieldGene(const FieldGeneParameters& parameters, const FieldGene& other)
-		: parameters(parameters)
-	{
-		using namespace dnf_composer::element;
-		const ElementDimensions dimensions = other.getNeuralField()->getElementCommonParameters().dimensionParameters;
-
-		const std::shared_ptr<NeuralField> nf = other.getNeuralField();
-		const ElementCommonParameters nfcp{ std::format("{}{}", NeuralFieldConstants::namePrefix, parameters.id), dimensions };
-		neuralField = std::make_shared<NeuralField>(nfcp, nf->getParameters());
-
-		const auto k = other.getKernel();
-		switch (k->getLabel())
-		{
-			case ElementLabel::GAUSS_KERNEL:
-				{
-					const auto gkp = std::dynamic_pointer_cast<GaussKernel>(k)->getParameters();
-					const ElementCommonParameters gkcp{ std::format("{}{}", GaussKernelConstants::namePrefix, parameters.id), dimensions };
-					kernel = std::make_shared<GaussKernel>(gkcp, gkp);
-				}
-				break;
-			case ElementLabel::MEXICAN_HAT_KERNEL:
-				{
-					const auto mhkp = std::dynamic_pointer_cast<MexicanHatKernel>(k)->getParameters();
-					const ElementCommonParameters mhcp{ std::format("{}{}", MexicanHatKernelConstants::namePrefix, parameters.id), dimensions };
-					kernel = std::make_shared<MexicanHatKernel>(mhcp, mhkp);
-				}
-				break;
-			default:				
-				tools::logger::log(tools::logger::FATAL, "FieldGene::FieldGene() - Kernel type not recognized.");
-				throw std::runtime_error("FieldGene::FieldGene() - Kernel type not recognized.");
-		}
+		: parameters(parameters),
+		dimensions(other.dimensions),
+		neuralFieldParameters(other.neuralFieldParameters),
+		kernelParameters(other.kernelParameters),
+		noiseParameters(other.noiseParameters)
+	{}
 
-		const std::shared_ptr<NormalNoise> nn = other.getNoise();
-		const ElementCommonParameters nncp{ std::format("{}{}", NoiseConstants::namePrefix, parameters.id), dimensions };
-		noise = std::make_shared<NormalNoise>(nncp, nn->getParameters());
-	}
+	FieldGene::FieldGene(const FieldGeneParameters& parameters,
+		const dnf_composer::element::ElementDimensions& dimensions,
+		const dnf_composer::element::NeuralFieldParameters& neuralFieldParameters,
+		const KernelParameters& kernelParameters,
+		const dnf_composer::element::NormalNoiseParameters& noiseParameters)
+		: parameters(parameters),
+		dimensions(dimensions),
+		neuralFieldParameters(neuralFieldParameters),
+		kernelParameters(kernelParameters),
+		noiseParameters(noiseParameters)
+	{}
 
 	void FieldGene::setAsInput(const dnf_composer::element::ElementDimensions& dimensions)
 	{
-		parameters.type = FieldGeneType::INPUT;
-		initializeNeuralField(dimensions);
-		initializeKernel(dimensions);
-		initializeNoise(dimensions);
+		setAs(FieldGeneType::INPUT, dimensions);
 	} 
 
 	void FieldGene::setAsOutput(const dnf_composer::element::ElementDimensions& dimensions)
 	{
-		parameters.type = FieldGeneType::OUTPUT;
-		initializeNeuralField(dimensions);
-		initializeKernel(dimensions);
-		initializeNoise(dimensions);
+		setAs(FieldGeneType::OUTPUT, dimensions);
 	}
 
 	void FieldGene::setAsHidden(const dnf_composer::element::ElementDimensions& dimensions)
 	{
-		parameters.type = FieldGeneType::HIDDEN;
+		setAs(FieldGeneType::HIDDEN, dimensions);
+	}
 
-		initializeNeuralField(dimensions);
-		initializeKernel(dimensions);
-		initializeNoise(dimensions);
+	void FieldGene::setAs(const FieldGeneType type, const dnf_composer::element::ElementDimensions& dimensions)
+	{
+		parameters.type = type;
+		this->dimensions = dimensions;
+		neuralFieldParameters = makeNeuralFieldParameters();
+		kernelParameters = makeKernelParameters();
+		noiseParameters = makeNoiseParameters();
 	}
 
 	void FieldGene::mutate()
@@ -163,19 +138,58 @@ namespace neat_dnfs
 		return mutationsInLastGeneration;
 	}
 
+	std::string FieldGene::getNeuralFieldName() const
+	{
+		return std::format("{}{}", NeuralFieldConstants::namePrefix, parameters.id);
+	}
+
+	std::string FieldGene::getKernelName() const
+	{
+		using namespace dnf_composer::element;
+
+		switch (getKernelLabel())
+		{
+		case ElementLabel::GAUSS_KERNEL:
+			return std::format("{}{}", GaussKernelConstants::namePrefix, parameters.id);
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+			return std::format("{}{}", MexicanHatKernelConstants::namePrefix, parameters.id);
+		default:
+			return std::format("{}{}", OscillatoryKernelConstants::namePrefix, parameters.id);
+		}
+	}
+
+	std::string FieldGene::getNoiseName() const
+	{
+		return std::format("{}{}", NoiseConstants::namePrefix, parameters.id);
+	}
+
 	NeuralFieldPtr FieldGene::getNeuralField() const
 	{
-		return neuralField;
+		using namespace dnf_composer::element;
+		return std::make_shared<NeuralField>(ElementCommonParameters{ getNeuralFieldName(), dimensions }, neuralFieldParameters);
 	}
 
 	KernelPtr FieldGene::getKernel() const
 	{
-		return kernel;
+		using namespace dnf_composer::element;
+		return makeKernel(ElementCommonParameters{ getKernelName(), dimensions }, kernelParameters);
 	}
 
 	std::shared_ptr<dnf_composer::element::NormalNoise> FieldGene::getNoise() const
 	{
-		return noise;
+		using namespace dnf_composer::element;
+		return std::make_shared<NormalNoise>(ElementCommonParameters{ getNoiseName(), dimensions }, noiseParameters);
+	}
+
+	std::shared_ptr<dnf_composer::element::NormalNoise> FieldGene::getNoise(const std::shared_ptr<const tools::NoiseTape>& tape) const
+	{
+		using namespace dnf_composer::element;
+		if (!tape)
+		{
+			return getNoise();
+		}
+		return std::make_shared<TapeNoise>(ElementCommonParameters{ getNoiseName(), dimensions }, noiseParameters,
+			tape, static_cast<size_t>(parameters.id));
 	}
 
 	bool FieldGene::operator==(const FieldGene& other) const
@@ -185,10 +199,10 @@ namespace neat_dnfs
 
 	bool FieldGene::isCloneOf(const FieldGene& other) const
 	{
-		using namespace dnf_composer::element;
-		const auto k_other = other.getKernel();
-		const auto nf_other = other.getNeuralField();
-		return parameters == other.parameters && neuralField == nf_other && kernel == k_other;
+		return parameters == other.parameters &&
+			neuralFieldParameters.tau == other.neuralFieldParameters.tau &&
+			neuralFieldParameters.startingRestingLevel == other.neuralFieldParameters.startingRestingLevel &&
+			sameKernelParameters(kernelParameters, other.kernelParameters);
 	}
 
 	std::string FieldGene::toString() const
@@ -207,17 +221,51 @@ namespace neat_dnfs
 
 	FieldGene FieldGene::clone() const
 	{
-		const auto nf = neuralField->clone();
-		const auto k = kernel->clone();
-		
-		const auto nf_ = std::dynamic_pointer_cast<dnf_composer::element::NeuralField>(nf);
-		const auto k_ = std::dynamic_pointer_cast<dnf_composer::element::Kernel>(k);
-
-		FieldGene clone{ parameters, nf_, k_ };
+		FieldGene clone{ *this };
+		clone.clearLastMutations();
 		return clone;
 	}
 
-	void FieldGene::initializeNeuralField(const dnf_composer::element::ElementDimensions& dimensions)
+	void FieldGene::serialize(tools::BinaryWriter& writer) const
+	{
+		writer.write(static_cast<std::int32_t>(parameters.type));
+		writer.write(static_cast<std::int32_t>(parameters.id));
+		writer.write(static_cast<std::int32_t>(dimensions.size));
+		writer.write(dimensions.d_x);
+		writer.write(neuralFieldParameters.tau);
+		writer.write(neuralFieldParameters.startingRestingLevel);
+		serializeKernelParameters(writer, kernelParameters);
+		writer.write(noiseParameters.amplitude);
+		writer.writeString(mutationsInLastGeneration);
+	}
+
+	FieldGene FieldGene::deserialize(tools::BinaryReader& reader)
+	{
+		using namespace dnf_composer::element;
+
+		const auto type = static_cast<FieldGeneType>(reader.read<std::int32_t>());
+		if (type != FieldGeneType::INPUT && type != FieldGeneType::OUTPUT && type != FieldGeneType::HIDDEN)
+		{
+			throw std::runtime_error("FieldGene::deserialize() - Unknown field gene type.");
+		}
+		const int id = reader.read<std::int32_t>();
+		const int size = reader.read<std::int32_t>();
+		const auto d_x = reader.read<double>();
+		const auto tau = reader.read<double>();
+		const auto restingLevel = reader.read<double>();
+		const KernelParameters kernel = deserializeKernelParameters(reader);
+		const auto noiseAmplitude = reader.read<double>();
+
+		FieldGene gene{ FieldGeneParameters{ type, id },
+			ElementDimensions{ size, d_x },
+			NeuralFieldParameters{ tau, restingLevel, NeuralFieldConstants::activationFunction },
+			kernel,
+			NormalNoiseParameters{ noiseAmplitude } };
+		gene.mutationsInLastGeneration = reader.readString();
+		return gene;
+	}
+
+	dnf_composer::element::NeuralFieldParameters FieldGene::makeNeuralFieldParameters()
 	{
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
@@ -226,22 +274,15 @@ namespace neat_dnfs
 		{
 			const double tau = generateRandomDouble(NeuralFieldConstants::tauMinVal, NeuralFieldConstants::tauMaxVal);
 			const double restingLevel = generateRandomDouble(NeuralFieldConstants::restingLevelMinVal, NeuralFieldConstants::restingLevelMaxVal);
-
-			const NeuralFieldParameters nfp{ tau, restingLevel, NeuralFieldConstants::activationFunction };
-			const ElementCommonParameters nfcp{ std::format("{}{}", NeuralFieldConstants::namePrefix, parameters.id), dimensions };
-			neuralField = std::make_shared<NeuralField>(nfcp, nfp);
-		}
-		else
-		{
-			constexpr double tau = NeuralFieldConstants::tau;
-			constexpr double restingLevel = NeuralFieldConstants::restingLevel;
-			const NeuralFieldParameters nfp{ tau, restingLevel, NeuralFieldConstants::activationFunction };
-			const ElementCommonParameters nfcp{ std::format("{}{}", NeuralFieldConstants::namePrefix, parameters.id), dimensions };
-			neuralField = std::make_shared<NeuralField>(nfcp, nfp);
+			return NeuralFieldParameters{ tau, restingLevel, NeuralFieldConstants::activationFunction };
 		}
+
+		constexpr double tau = NeuralFieldConstants::tau;
+		constexpr double restingLevel = NeuralFieldConstants::restingLevel;
+		return NeuralFieldParameters{ tau, restingLevel, NeuralFieldConstants::activationFunction };
 	}
 
-	void FieldGene::initializeKernel(const dnf_composer::element::ElementDimensions& dimensions)
+	KernelParameters FieldGene::makeKernelParameters()
 	{
 		using namespace neat_dnfs::tools::utils;
 
@@ -257,16 +298,12 @@ namespace neat_dnfs
 		const double randomValue = generateRandomDouble(0.0, 1.0);
 		if (randomValue < FieldGeneConstants::gaussKernelProbability)
 		{
-			initializeGaussKernel(dimensions);
-		}
-		else
-		{
-			initializeMexicanHatKernel(dimensions);
+			return makeGaussKernelParameters();
 		}
-
+		return makeMexicanHatKernelParameters();
 	}
 
-	void FieldGene::initializeGaussKernel(const dnf_composer::element::ElementDimensions& dimensions)
+	dnf_composer::element::GaussKernelParameters FieldGene::makeGaussKernelParameters()
 	{
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
@@ -276,30 +313,24 @@ namespace neat_dnfs
 			const double width = generateRandomDouble(GaussKernelConstants::widthMinVal, GaussKernelConstants::widthMaxVal);
 			const double amplitude = generateRandomDouble(GaussKernelConstants::ampMinVal, GaussKernelConstants::ampMaxVal);
 			const double amplitudeGlobal = generateRandomDouble(GaussKernelConstants::ampGlobalMinVal, GaussKernelConstants::ampGlobalMaxVal);
-			const GaussKernelParameters gkp{ width,
-											amplitude,
-												amplitudeGlobal,
-										KernelConstants::circularity,
-										KernelConstants::normalization
-			};
-			const ElementCommonParameters gkcp{ std::format("{}{}", GaussKernelConstants::namePrefix, parameters.id), dimensions };
-			kernel = std::make_shared<GaussKernel>(gkcp, gkp);
-		}
-		else
-		{
-			constexpr double width = GaussKernelConstants::width;
-			constexpr double amplitude = GaussKernelConstants::amplitude;
-			constexpr double amplitudeGlobal = GaussKernelConstants::amplitudeGlobal;
-			const GaussKernelParameters gkp{ width, amplitude, amplitudeGlobal,
+			return GaussKernelParameters{ width,
+										amplitude,
+										amplitudeGlobal,
 										KernelConstants::circularity,
 										KernelConstants::normalization
 			};
-			const ElementCommonParameters gkcp{ std::format("{}{}", GaussKernelConstants::namePrefix, parameters.id), dimensions };
-			kernel = std::make_shared<GaussKernel>(gkcp, gkp);
 		}
+
+		constexpr double width = GaussKernelConstants::width;
+		constexpr double amplitude = GaussKernelConstants::amplitude;
+		constexpr double amplitudeGlobal = GaussKernelConstants::amplitudeGlobal;
+		return GaussKernelParameters{ width, amplitude, amplitudeGlobal,
+									KernelConstants::circularity,
+									KernelConstants::normalization
+		};
 	}
 
-	void FieldGene::initializeMexicanHatKernel(const dnf_composer::element::ElementDimensions& dimensions)
+	dnf_composer::element::MexicanHatKernelParameters FieldGene::makeMexicanHatKernelParameters()
 	{
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
@@ -309,7 +340,7 @@ namespace neat_dnfs
 		const double widthInh = generateRandomDouble(MexicanHatKernelConstants::widthInhMinVal, MexicanHatKernelConstants::widthInhMaxVal);
 		const double amplitudeInh = generateRandomDouble(MexicanHatKernelConstants::ampInhMinVal, MexicanHatKernelConstants::ampInhMaxVal);
 		const double amplitudeGlobal = generateRandomDouble(MexicanHatKernelConstants::ampGlobMin, MexicanHatKernelConstants::ampGlobMax);
-		const MexicanHatKernelParameters mhkp{ widthExc,
+		return MexicanHatKernelParameters{ widthExc,
 								amplitudeExc,
 								widthInh,
 								amplitudeInh,
@@ -317,23 +348,16 @@ namespace neat_dnfs
 								KernelConstants::circularity,
 								KernelConstants::normalization
 		};
-		const ElementCommonParameters mhcp{ std::format("{}{}", MexicanHatKernelConstants::namePrefix, parameters.id), dimensions };
-		kernel = std::make_shared<MexicanHatKernel>(mhcp, mhkp);
 	}
 
-	void FieldGene::initializeNoise(const dnf_composer::element::ElementDimensions& dimensions)
+	dnf_composer::element::NormalNoiseParameters FieldGene::makeNoiseParameters()
 	{
-		using namespace dnf_composer::element;
-		using namespace neat_dnfs::tools::utils;
-
-		const NormalNoiseParameters nnp{ NoiseConstants::amplitude };
-		const ElementCommonParameters nncp{ std::format("{}{}", NoiseConstants::namePrefix, parameters.id), dimensions };
-		noise = std::make_shared<NormalNoise>(nncp, nnp);
+		return dnf_composer::element::NormalNoiseParameters{ NoiseConstants::amplitude };
 	}
 
 	void FieldGene::mutateKernel()
 	{
-		switch (kernel->getLabel())
+		switch (getKernelLabel())
 		{
 		case dnf_composer::element::ElementLabel::GAUSS_KERNEL:
 			mutateGaussKernel();
@@ -354,8 +378,7 @@ namespace neat_dnfs
 
 		const int signal = generateRandomSignal(); // +/- to add or sum a step
 
-		const auto gaussKernel = std::dynamic_pointer_cast<GaussKernel>(kernel);
-		GaussKernelParameters gkp = std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters();
+		auto& gkp = std::get<GaussKernelParameters>(kernelParameters);
 
 		if (generateRandomDouble(0.0, 1.0) < FieldGeneConstants::mutateFieldGeneGaussKernelWidthProbability)
 		{
@@ -380,8 +403,6 @@ namespace neat_dnfs
 								GaussKernelConstants::ampGlobalMaxVal);
 			mutationsInLastGeneration += std::format("(fg gk amp. glob. {})", GaussKernelConstants::ampGlobalStep * signal);
 		}
-		std::dynamic_pointer_cast<GaussKernel>(kernel)->setParameters(gkp);
-
 	}
 
 	void FieldGene::mutateMexicanHatKernel()
@@ -391,8 +412,7 @@ namespace neat_dnfs
 
 		const int signal = generateRandomSignal();  // +/- to add or sum a step
 
-		const auto mexicanHatKernel = std::dynamic_pointer_cast<MexicanHatKernel>(kernel);
-		MexicanHatKernelParameters mhkp = std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters();
+		auto& mhkp = std::get<MexicanHatKernelParameters>(kernelParameters);
 
 		if(generateRandomDouble(0.0, 1.0) < FieldGeneConstants::mutateFieldGeneMexicanHatKernelAmplitudeExcProbability)
 		{
@@ -433,7 +453,6 @@ namespace neat_dnfs
 															MexicanHatKernelConstants::ampGlobMax);
 			mutationsInLastGeneration += std::format("(fg mhk amp. glob. {})", MexicanHatKernelConstants::ampGlobStep * signal);
 		}
-		std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->setParameters(mhkp);
 	}
 
 	void FieldGene::mutateKernelType()
@@ -441,8 +460,6 @@ namespace neat_dnfs
 		using namespace dnf_composer::element;
 		using namespace neat_dnfs::tools::utils;
 
-		const auto dimensions = neuralField->getElementCommonParameters().dimensionParameters;
-
 		constexpr double totalProbability = FieldGeneConstants::gaussKernelProbability +
 			FieldGeneConstants::mexicanHatKernelProbability;
 
@@ -456,12 +473,12 @@ namespace neat_dnfs
 
 		if (randomValue < FieldGeneConstants::gaussKernelProbability)
 		{
-			initializeGaussKernel(dimensions);
+			kernelParameters = makeGaussKernelParameters();
 			mutationsInLastGeneration += "(mhk to gk)";
 		}
 		else if (randomValue < FieldGeneConstants::gaussKernelProbability + FieldGeneConstants::mexicanHatKernelProbability)
 		{
-			initializeMexicanHatKernel(dimensions);
+			kernelParameters = makeMexicanHatKernelParameters();
 			mutationsInLastGeneration += "(gk to mhk)";
 		}
 	}
@@ -478,7 +495,7 @@ namespace neat_dnfs
 		}
 
 		const double signal = tools::utils::generateRandomSignal();
-		dnf_composer::element::NeuralFieldParameters nfp = neuralField->getParameters();
+		auto& nfp = neuralFieldParameters;
 
 		const double mutationSelection = tools::utils::generateRandomDouble(0.0, 1.0);
 		if (mutationSelection < FieldGeneConstants::mutateFieldGeneNeuralFieldParametersProbability)
@@ -486,29 +503,24 @@ namespace neat_dnfs
 			if (tools::utils::generateRandomDouble(0.0, 1.0) <
 				FieldGeneConstants::mutateFieldGeneNeuralFieldParametersTauProbability)
 			{
-				const double tau = neuralField->getParameters().tau;
-				nfp.tau = std::clamp(tau + NeuralFieldConstants::tauStep * signal,
+				nfp.tau = std::clamp(nfp.tau + NeuralFieldConstants::tauStep * signal,
 													NeuralFieldConstants::tauMinVal,
 													NeuralFieldConstants::tauMaxVal);
-				neuralField->setParameters(nfp);
 				mutationsInLastGeneration += std::format("(fg nf tau {})", NeuralFieldConstants::tauStep * signal);
 			}
 
 			if (tools::utils::generateRandomDouble(0.0, 1.0) <
 				FieldGeneConstants::mutateFieldGeneNeuralFieldParametersRestingLevelProbability)
 			{
-				const double restingLevel = neuralField->getParameters().startingRestingLevel;
-				nfp.startingRestingLevel = std::clamp(restingLevel + NeuralFieldConstants::restingLevelStep * signal,
+				nfp.startingRestingLevel = std::clamp(nfp.startingRestingLevel + NeuralFieldConstants::restingLevelStep * signal,
 													NeuralFieldConstants::restingLevelMinVal,
 													NeuralFieldConstants::restingLevelMaxVal);
-				neuralField->setParameters(nfp);
 				mutationsInLastGeneration += std::format("(fg nf rest. lvl. {})", NeuralFieldConstants::restingLevelStep * signal);
 			}
 		}
 		else
 		{
-			dnf_composer::element::ElementCommonParameters nfcp = neuralField->getElementCommonParameters();
-			initializeNeuralField(nfcp.dimensionParameters);
+			neuralFieldParameters = makeNeuralFieldParameters();
 			mutationsInLastGeneration += "(fg nf rand.)";
 		}
 	}
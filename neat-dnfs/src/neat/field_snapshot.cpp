@@ -0,0 +1,110 @@
+#include "neat/field_snapshot.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace neat_dnfs
+{
+	void FieldSnapshot::take(const std::span<const double> fieldActivation, const double d_x, const double fieldRestingLevel)
+	{
+		if (fieldActivation.empty())
+		{
+			throw std::invalid_argument("FieldSnapshot: a field has at least one sample.");
+		}
+
+		activation.assign(fieldActivation.begin(), fieldActivation.end());
+		dx = d_x;
+		restingLevel = fieldRestingLevel;
+		bumps.clear();
+
+		highestActivation = activation.front();
+		highestActivationIndex = 0;
+		lowestActivation = activation.front();
+		double sum = 0.0;
+		size_t runStart = 0;
+		double runAmplitude = 0.0;
+		bool inRun = false;
+		const auto closeRun = [this, &runStart, &runAmplitude](const size_t runEnd)
+			{
+				dnf_composer::element::NeuralFieldBump bump;
+				bump.startPosition = static_cast<double>(runStart) * dx;
+				bump.endPosition = static_cast<double>(runEnd - 1) * dx;
+				bump.centroid = 0.5 * (bump.startPosition + bump.endPosition);
+				bump.width = static_cast<double>(runEnd - runStart) * dx;
+				bump.amplitude = runAmplitude;
+				bumps.push_back(bump);
+			};
+
+		for (size_t x = 0; x < activation.size(); ++x)
+		{
+			const double u = activation[x];
+			sum += u;
+			lowestActivation = std::min(lowestActivation, u);
+			if (u > highestActivation)
+			{
+				highestActivation = u;
+				highestActivationIndex = x;
+			}
+
+			if (u > 0.0)
+			{
+				if (!inRun)
+				{
+					runStart = x;
+					runAmplitude = u;
+					inRun = true;
+				}
+				runAmplitude = std::max(runAmplitude, u);
+			}
+			else if (inRun)
+			{
+				closeRun(x);
+				inRun = false;
+			}
+		}
+		if (inRun)
+		{
+			closeRun(activation.size());
+			if (bumps.size() > 1 && activation.front() > 0.0)
+			{
+				mergeWrappedBump();
+			}
+		}
+		meanActivation = sum / static_cast<double>(activation.size());
+	}
+
+	void FieldSnapshot::mergeWrappedBump()
+	{
+		// The last run continues into the first across the edge: one bump
+		// starting where the last run starts and ending where the first ends,
+		// centred halfway along it, wrapped back into the field.
+		const dnf_composer::element::NeuralFieldBump first = bumps.front();
+		auto& wrapped = bumps.back();
+		const double extent = static_cast<double>(activation.size()) * dx;
+		wrapped.endPosition = first.endPosition;
+		wrapped.width += first.width;
+		wrapped.amplitude = std::max(wrapped.amplitude, first.amplitude);
+		wrapped.centroid = std::fmod(wrapped.startPosition + 0.5 * (wrapped.width - dx), extent);
+		bumps.erase(bumps.begin());
+	}
+
+	size_t FieldSnapshot::indexOf(const double position) const
+	{
+		const int rawIndex = static_cast<int>(position / dx);
+		const int lastValidIndex = static_cast<int>(activation.size()) - 1;
+		return static_cast<size_t>(std::clamp(rawIndex, 0, lastValidIndex));
+	}
+
+	std::vector<dnf_composer::element::NeuralFieldBump> findBumps(const std::span<const double> activation, const double dx)
+	{
+		if (activation.empty())
+		{
+			return {};
+		}
+		FieldSnapshot snapshot;
+		snapshot.take(activation, dx, 0.0);
+		return std::move(snapshot.bumps);
+	}
+}
@@ -0,0 +1,194 @@
+#include "neat/fitness_cache.h"
+
+#include <algorithm>
+
+namespace neat_dnfs
+{
+	FitnessCache::FitnessCache(const FitnessCachePolicy policy, const int samples)
+		: policy(policy), samples(samples)
+	{
+		if (samples <= 0)
+		{
+			throw std::invalid_argument("Fitness cache samples must be greater than 0");
+		}
+	}
+
+	std::vector<SolutionPtr> FitnessCache::restore(const std::vector<SolutionPtr>& solutions)
+	{
+		hits = 0;
+		misses = 0;
+		liveGenomes.clear();
+		firstOccurrences.clear();
+		pendingHashes.clear();
+		duplicates.clear();
+
+		if (policy == FitnessCachePolicy::Disabled)
+		{
+			misses = static_cast<int>(solutions.size());
+			return solutions;
+		}
+
+		std::vector<SolutionPtr> pending;
+		pending.reserve(solutions.size());
+		for (const auto& solution : solutions)
+		{
+			const std::uint64_t hash = solution->getGenome().contentHash();
+			const GenomeKey key = makeKey(solution->getGenome());
+			liveGenomes[hash]++;
+			const auto [first, isFirst] = firstOccurrences.try_emplace(hash, key, solution);
+
+			const auto entry = entries.find(hash);
+			const bool complete = entry != entries.end() && entry->second.key == key &&
+				(policy == FitnessCachePolicy::Reuse || entry->second.samples >= samples);
+			if (complete)
+			{
+				solution->setEvaluationResult(entry->second.fitness, entry->second.partialFitness);
+				hits++;
+				continue;
+			}
+
+			// Under Reuse, a genome that appears several times in one generation
+			// is simulated once and the result is copied onto the others.
+			if (policy == FitnessCachePolicy::Reuse && !isFirst && first->second.first == key)
+			{
+				duplicates.emplace_back(solution, first->second.second);
+				hits++;
+				continue;
+			}
+
+			pending.push_back(solution);
+			pendingHashes.emplace_back(hash, key);
+			misses++;
+		}
+		return pending;
+	}
+
+	void FitnessCache::record(const std::vector<SolutionPtr>& evaluated)
+	{
+		if (policy == FitnessCachePolicy::Disabled)
+		{
+			return;
+		}
+
+		if (evaluated.size() != pendingHashes.size())
+		{
+			throw std::logic_error("FitnessCache::record() must be given exactly the solutions returned by restore().");
+		}
+
+		for (size_t i = 0; i < evaluated.size(); ++i)
+		{
+			const auto& solution = evaluated[i];
+			const auto result = solution->getParameters();
+			const auto& [hash, key] = pendingHashes[i];
+			Entry& entry = entries[hash];
+
+			// A colliding genome takes the entry over; the other one is
+			// simulated again the next time it comes up.
+			if (entry.key != key)
+			{
+				entry = Entry{ key };
+			}
+
+			// A truncated evaluation only holds under this generation's early
+			// termination threshold, so it is handed to this generation's
+			// duplicates but never counts as a sample.
+			if (result.evaluationTruncated)
+			{
+				if (entry.samples == 0)
+				{
+					entry.fitness = result.fitness;
+					entry.partialFitness = result.partialFitness;
+				}
+				continue;
+			}
+
+			if (policy == FitnessCachePolicy::Reuse || entry.samples == 0 ||
+				entry.partialFitness.size() != result.partialFitness.size())
+			{
+				entry.fitness = result.fitness;
+				entry.partialFitness = result.partialFitness;
+				entry.samples = 1;
+				continue;
+			}
+
+			const double weight = 1.0 / static_cast<double>(entry.samples + 1);
+			entry.fitness += (result.fitness - entry.fitness) * weight;
+			for (size_t p = 0; p < entry.partialFitness.size(); ++p)
+			{
+				entry.partialFitness[p] += (result.partialFitness[p] - entry.partialFitness[p]) * weight;
+			}
+			entry.samples++;
+			solution->setEvaluationResult(entry.fitness, entry.partialFitness);
+		}
+
+		for (const auto& [solution, representative] : duplicates)
+		{
+			// Copied from the representative rather than its entry, which a
+			// colliding genome may have taken over.
+			const auto result = representative->getParameters();
+			solution->setEvaluationResult(result.fitness, result.partialFitness, result.evaluationTruncated);
+		}
+		duplicates.clear();
+		firstOccurrences.clear();
+		pendingHashes.clear();
+
+		std::erase_if(entries, [this](const auto& keyAndEntry)
+			{
+				return keyAndEntry.second.samples == 0 || !liveGenomes.contains(keyAndEntry.first);
+			});
+	}
+
+	void FitnessCache::clear()
+	{
+		entries.clear();
+		liveGenomes.clear();
+		firstOccurrences.clear();
+		pendingHashes.clear();
+		duplicates.clear();
+		hits = 0;
+		misses = 0;
+	}
+
+	void FitnessCache::serialize(tools::BinaryWriter& writer) const
+	{
+		writer.write(static_cast<std::uint64_t>(entries.size()));
+		for (const auto& [hash, entry] : entries)
+		{
+			writer.write(hash);
+			writer.write(entry.key.fieldGenes);
+			writer.write(entry.key.connectionGenes);
+			writer.write(entry.key.enabledConnectionGenes);
+			writer.write(entry.fitness);
+			writer.writeVector(entry.partialFitness);
+			writer.write(static_cast<std::int32_t>(entry.samples));
+		}
+	}
+
+	void FitnessCache::deserialize(tools::BinaryReader& reader)
+	{
+		clear();
+		const size_t numEntries = reader.readSequenceSize(sizeof(std::uint64_t) + sizeof(Entry));
+		for (size_t i = 0; i < numEntries; ++i)
+		{
+			const auto hash = reader.read<std::uint64_t>();
+			Entry& entry = entries[hash];
+			entry.key.fieldGenes = reader.read<std::uint64_t>();
+			entry.key.connectionGenes = reader.read<std::uint64_t>();
+			entry.key.enabledConnectionGenes = reader.read<std::uint64_t>();
+			entry.fitness = reader.read<double>();
+			entry.partialFitness = reader.readVector<double>();
+			entry.samples = reader.read<std::int32_t>();
+		}
+	}
+
+	FitnessCache::GenomeKey FitnessCache::makeKey(const Genome& genome)
+	{
+		const auto& connectionGenes = genome.getConnectionGenes();
+		return {
+			genome.getFieldGenes().size(),
+			connectionGenes.size(),
+			static_cast<std::uint64_t>(std::ranges::count_if(connectionGenes,
+				[](const ConnectionGene& gene) { return gene.isEnabled(); }))
+		};
+	}
+}
@@ -106,6 +106,12 @@ namespace neat_dnfs
 		globalInnovationNumber = 0;
 	}
 
+	void Genome::setGlobalInnovationNumber(const int innovationNumber)
+	{
+		std::scoped_lock lock(innovationMutex);
+		globalInnovationNumber = innovationNumber;
+	}
+
 	void Genome::clearLastMutations()
 	{
 		mutationsInLastGeneration = "";
@@ -134,6 +140,7 @@ namespace neat_dnfs
 		}
 
 		connectionGenes.erase(it);
+		unindexConnectionGene(innov);
 	}
 
 	const std::vector<FieldGene>& Genome::getFieldGenes() const
@@ -171,115 +178,76 @@ namespace neat_dnfs
 
 	int Genome::excessGenes(const Genome& other) const
 	{
-		const auto thisInnovationNumbers = getInnovationNumbers();
-		const auto otherInnovationNumbers = other.getInnovationNumbers();
-		int thisMaxInnovationNumber = 0;
-		int otherMaxInnovationNumber = 0;
-
-		if (thisInnovationNumbers.empty() && otherInnovationNumbers.empty())
-		{
-			return 0;
-		}
-
-		if (!thisInnovationNumbers.empty())
-		{
-			thisMaxInnovationNumber = *std::ranges::max_element(thisInnovationNumbers);
-		}
-
-		if (!otherInnovationNumbers.empty())
-		{
-			otherMaxInnovationNumber = *std::ranges::max_element(otherInnovationNumbers);
-		}
-
-		const int thisExcessCount = static_cast<int>(std::ranges::count_if(thisInnovationNumbers,
-			[otherMaxInnovationNumber](const int innovationNumber)
-			{
-				return innovationNumber > otherMaxInnovationNumber;
-			}));
+		return compatibilityTerms(other).excessGenes;
+	}
 
-		const int otherExcessCount = static_cast<int>(std::ranges::count_if(otherInnovationNumbers,
-			[thisMaxInnovationNumber](const int innovationNumber)
-			{
-				return innovationNumber > thisMaxInnovationNumber;
-			}));
+	int Genome::disjointGenes(const Genome& other) const
+	{
+		return compatibilityTerms(other).disjointGenes;
+	}
 
-		return thisExcessCount + otherExcessCount;
+	double Genome::averageConnectionDifference(const Genome& other) const
+	{
+		return compatibilityTerms(other).averageConnectionDifference;
 	}
 
-	int Genome::disjointGenes(const Genome& other) const
+	CompatibilityTerms Genome::compatibilityTerms(const Genome& other) const
 	{
-		const auto thisInnovationNumbers = getInnovationNumbers();
-		const auto otherInnovationNumbers = other.getInnovationNumbers();
+		CompatibilityTerms terms;
+		const auto& thisInnovationNumbers = sortedInnovationNumbers;
+		const auto& otherInnovationNumbers = other.sortedInnovationNumbers;
 
 		if (thisInnovationNumbers.empty() && otherInnovationNumbers.empty())
 		{
-			return 0;
+			return terms;
 		}
 
-		std::vector<int> sortedThisInnovationNumbers = thisInnovationNumbers;
-		std::vector<int> sortedOtherInnovationNumbers = otherInnovationNumbers;
-
-		std::ranges::sort(sortedThisInnovationNumbers);
-		std::ranges::sort(sortedOtherInnovationNumbers);
+		// An empty genome's max innovation number counts as 0.
+		const int thisMaxInnovationNumber = thisInnovationNumbers.empty() ? 0 : thisInnovationNumbers.back();
+		const int otherMaxInnovationNumber = otherInnovationNumbers.empty() ? 0 : otherInnovationNumbers.back();
+		const int minMaxInnovationNumber = std::min(thisMaxInnovationNumber, otherMaxInnovationNumber);
 
-		std::vector<int> thisDisjointInnovationNumbers;
-		std::vector<int> otherDisjointInnovationNumbers;
-
-		std::ranges::set_difference(sortedThisInnovationNumbers,
-			sortedOtherInnovationNumbers, std::back_inserter(thisDisjointInnovationNumbers));
-		std::ranges::set_difference(sortedOtherInnovationNumbers,
-			sortedThisInnovationNumbers, std::back_inserter(otherDisjointInnovationNumbers));
-
-		const int thisMaxInnovationNumber = !thisInnovationNumbers.empty() ? *std::ranges::max_element(thisInnovationNumbers) : 0;
-		const int otherMaxInnovationNumber = !otherInnovationNumbers.empty() ? *std::ranges::max_element(otherInnovationNumbers) : 0;
-		int minMaxInnovationNumber = std::min(thisMaxInnovationNumber, otherMaxInnovationNumber);
-
-		const int thisDisjointCount = static_cast<int>(std::ranges::count_if(thisDisjointInnovationNumbers,
-			[minMaxInnovationNumber](const int innovationNumber)
+		// A gene found in only one genome is excess if it lies beyond the other
+		// genome's max innovation number, and disjoint if it lies within both ranges.
+		const auto countUnmatched = [&terms, minMaxInnovationNumber](const int innovationNumber, const int otherMax)
 			{
-				return innovationNumber <= minMaxInnovationNumber;
-			}));
-
-		const int otherDisjointCount = static_cast<int>(std::ranges::count_if(otherDisjointInnovationNumbers,
-			[minMaxInnovationNumber](const int innovationNumber)
-			{
-				return innovationNumber <= minMaxInnovationNumber;
-			}));
-
-		return thisDisjointCount + otherDisjointCount;
-	}
-
-	double Genome::averageConnectionDifference(const Genome& other) const
-	{
-		const auto& thisConnectionGenes = getConnectionGenes();
-		const auto& otherConnectionGenes = other.getConnectionGenes();
-
-		if (thisConnectionGenes.empty() && otherConnectionGenes.empty())
-		{
-			return 0.0;
-		}
+				if (innovationNumber > otherMax)
+				{
+					terms.excessGenes++;
+				}
+				if (innovationNumber <= minMaxInnovationNumber)
+				{
+					terms.disjointGenes++;
+				}
+			};
 
 		double sumAmpDiff = 0.0;
 		double sumWidthDiff = 0.0;
-
-		for (const auto& thisConnectionGene : thisConnectionGenes)
+		size_t i = 0;
+		size_t j = 0;
+		while (i < thisInnovationNumbers.size() || j < otherInnovationNumbers.size())
 		{
-			for (const auto& otherConnectionGene : otherConnectionGenes)
+			if (j == otherInnovationNumbers.size() ||
+				(i < thisInnovationNumbers.size() && thisInnovationNumbers[i] < otherInnovationNumbers[j]))
 			{
-				if (thisConnectionGene.getInnovationNumber() == otherConnectionGene.getInnovationNumber())
-				{
-					const double ampDiff =
-						std::abs(thisConnectionGene.getKernelAmplitude() - otherConnectionGene.getKernelAmplitude());
-					const double widthDiff =
-						std::abs(thisConnectionGene.getKernelWidth() - otherConnectionGene.getKernelWidth());
-					sumAmpDiff += ampDiff;
-					sumWidthDiff += widthDiff;
-				}
+				countUnmatched(thisInnovationNumbers[i++], otherMaxInnovationNumber);
+			}
+			else if (i == thisInnovationNumbers.size() || otherInnovationNumbers[j] < thisInnovationNumbers[i])
+			{
+				countUnmatched(otherInnovationNumbers[j++], thisMaxInnovationNumber);
+			}
+			else
+			{
+				sumAmpDiff += std::abs(sortedKernelAmplitudes[i] - other.sortedKernelAmplitudes[j]);
+				sumWidthDiff += std::abs(sortedKernelWidths[i] - other.sortedKernelWidths[j]);
+				++i;
+				++j;
 			}
 		}
-		const double totalDiff = CompatibilityCoefficients::amplitudeDifferenceCoefficient * sumAmpDiff
-								+ CompatibilityCoefficients::widthDifferenceCoefficient * sumWidthDiff;
-		return totalDiff;
+
+		terms.averageConnectionDifference = CompatibilityCoefficients::amplitudeDifferenceCoefficient * sumAmpDiff
+											+ CompatibilityCoefficients::widthDifferenceCoefficient * sumWidthDiff;
+		return terms;
 	}
 
 	void Genome::addFieldGene(const FieldGene& fieldGene)
@@ -298,6 +266,36 @@ namespace neat_dnfs
 			return;
 		}
 		connectionGenes.push_back(connectionGene);
+		indexConnectionGene(connectionGene);
+	}
+
+	void Genome::indexConnectionGene(const ConnectionGene& gene)
+	{
+		const int innov = gene.getInnovationNumber();
+		const auto it = std::ranges::lower_bound(sortedInnovationNumbers, innov);
+		const auto index = std::distance(sortedInnovationNumbers.begin(), it);
+		if (it != sortedInnovationNumbers.end() && *it == innov)
+		{
+			sortedKernelAmplitudes[index] = gene.getKernelAmplitude();
+			sortedKernelWidths[index] = gene.getKernelWidth();
+			return;
+		}
+		sortedInnovationNumbers.insert(it, innov);
+		sortedKernelAmplitudes.insert(sortedKernelAmplitudes.begin() + index, gene.getKernelAmplitude());
+		sortedKernelWidths.insert(sortedKernelWidths.begin() + index, gene.getKernelWidth());
+	}
+
+	void Genome::unindexConnectionGene(const int innov)
+	{
+		const auto it = std::ranges::lower_bound(sortedInnovationNumbers, innov);
+		if (it == sortedInnovationNumbers.end() || *it != innov)
+		{
+			return;
+		}
+		const auto index = std::distance(sortedInnovationNumbers.begin(), it);
+		sortedInnovationNumbers.erase(it);
+		sortedKernelAmplitudes.erase(sortedKernelAmplitudes.begin() + index);
+		sortedKernelWidths.erase(sortedKernelWidths.begin() + index);
 	}
 
 	bool Genome::containsConnectionGene(const ConnectionGene& connectionGene) const
@@ -353,11 +351,87 @@ namespace neat_dnfs
 		return *it;
 	}
 
+	void Genome::clear()
+	{
+		fieldGenes.clear();
+		connectionGenes.clear();
+		mutationsInLastGeneration.clear();
+		sortedInnovationNumbers.clear();
+		sortedKernelAmplitudes.clear();
+		sortedKernelWidths.clear();
+	}
+
+	void Genome::serialize(tools::BinaryWriter& writer) const
+	{
+		writer.write(static_cast<std::uint64_t>(fieldGenes.size()));
+		for (const auto& gene : fieldGenes)
+		{
+			gene.serialize(writer);
+		}
+		writer.write(static_cast<std::uint64_t>(connectionGenes.size()));
+		for (const auto& gene : connectionGenes)
+		{
+			gene.serialize(writer);
+		}
+		writer.writeString(mutationsInLastGeneration);
+	}
+
+	void Genome::deserialize(tools::BinaryReader& reader)
+	{
+		// Genes are restored in their original order, duplicates included, so
+		// the genome is exactly the one that was written.
+		clear();
+		const size_t numFieldGenes = reader.readSequenceSize(sizeof(FieldGene));
+		fieldGenes.reserve(numFieldGenes);
+		for (size_t i = 0; i < numFieldGenes; ++i)
+		{
+			fieldGenes.push_back(FieldGene::deserialize(reader));
+		}
+		const size_t numConnectionGenes = reader.readSequenceSize(sizeof(ConnectionGene));
+		connectionGenes.reserve(numConnectionGenes);
+		for (size_t i = 0; i < numConnectionGenes; ++i)
+		{
+			connectionGenes.push_back(ConnectionGene::deserialize(reader));
+			indexConnectionGene(connectionGenes.back());
+		}
+		mutationsInLastGeneration = reader.readString();
+	}
+
 	bool Genome::isEmpty() const
 	{
 		return fieldGenes.empty() && connectionGenes.empty();
 	}
 
+	std::uint64_t Genome::contentHash() const
+	{
+		using tools::utils::hashCombine;
+
+		std::uint64_t hash = 0;
+		hashCombine(hash, static_cast<std::uint64_t>(fieldGenes.size()));
+		for (const auto& fieldGene : fieldGenes)
+		{
+			const auto& nfp = fieldGene.getNeuralFieldParameters();
+			hashCombine(hash, static_cast<std::uint64_t>(fieldGene.getParameters().id));
+			hashCombine(hash, static_cast<std::uint64_t>(fieldGene.getParameters().type));
+			hashCombine(hash, static_cast<std::uint64_t>(fieldGene.getDimensions().size));
+			hashCombine(hash, fieldGene.getDimensions().d_x);
+			hashCombine(hash, nfp.tau);
+			hashCombine(hash, nfp.startingRestingLevel);
+			hashKernelParameters(hash, fieldGene.getKernelParameters());
+			hashCombine(hash, fieldGene.getNoiseParameters().amplitude);
+		}
+
+		hashCombine(hash, static_cast<std::uint64_t>(connectionGenes.size()));
+		for (const auto& connectionGene : connectionGenes)
+		{
+			hashCombine(hash, static_cast<std::uint64_t>(connectionGene.getInFieldGeneId()));
+			hashCombine(hash, static_cast<std::uint64_t>(connectionGene.getOutFieldGeneId()));
+			hashCombine(hash, static_cast<std::uint64_t>(connectionGene.isEnabled()));
+			hashKernelParameters(hash, connectionGene.getKernelParameters());
+		}
+		return hash;
+	}
+
 	bool Genome::operator==(const Genome& other) const
 	{
 		return fieldGenes == other.fieldGenes && connectionGenes == other.connectionGenes;
@@ -597,6 +671,7 @@ namespace neat_dnfs
 			// use the same innovation number
 		{
 			connectionGenes.emplace_back(connectionTuple, innov);
+			indexConnectionGene(connectionGenes.back());
 			mutationsInLastGeneration += "(added cg " + connectionTuple.toString()
 			+ " innov." + std::to_string(innov) + ")";
 		}
@@ -605,6 +680,7 @@ namespace neat_dnfs
 			// create new innovation number
 		{
 			connectionGenes.emplace_back(connectionTuple, globalInnovationNumber);
+			indexConnectionGene(connectionGenes.back());
 			connectionTupleAndInnovationNumberWithinGeneration[connectionTuple] = globalInnovationNumber;
 			mutationsInLastGeneration += "(added cg " + connectionTuple.toString()
 			+ " innov." + std::to_string(globalInnovationNumber) + ")";
@@ -625,7 +701,7 @@ namespace neat_dnfs
 
 		const auto inGeneId = randEnabledConnectionGene->getParameters().connectionTuple.inFieldGeneId;
 		const auto outGeneId = randEnabledConnectionGene->getParameters().connectionTuple.outFieldGeneId;
-		const auto kernel = randEnabledConnectionGene->getKernel();
+		const KernelParameters kernelParameters = randEnabledConnectionGene->getKernelParameters();
 
 		addHiddenGene(getFieldGeneById(inGeneId));
 
@@ -663,34 +739,15 @@ namespace neat_dnfs
 			innovIn,
 			in_kernel_p };
 
-		switch (kernel->getLabel())
-		{
-		case GAUSS_KERNEL:
-			{
-				const auto gkp = std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters();
-				const ConnectionGene connectionGeneOut{
-					ConnectionTuple{fieldGenes.back().getParameters().id, outGeneId},
-					innovOut,
-					gkp };
-				connectionGenes.emplace_back(connectionGeneIn);
-				connectionGenes.emplace_back(connectionGeneOut);
-			}
-			break;
-		case MEXICAN_HAT_KERNEL:
-			{
-				const auto mhkp = std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters();
-				const ConnectionGene connectionGeneOut{
-					ConnectionTuple{fieldGenes.back().getParameters().id, outGeneId},
-						innovOut,
-						mhkp };
-				connectionGenes.emplace_back(connectionGeneIn);
-				connectionGenes.emplace_back(connectionGeneOut);
-
-			}
-			break;
-		default:
-			throw std::invalid_argument("Invalid kernel type.");
-		}
+		// The outgoing half keeps the split connection's kernel.
+		const ConnectionGene connectionGeneOut{
+			ConnectionTuple{fieldGenes.back().getParameters().id, outGeneId},
+			innovOut,
+			kernelParameters };
+		connectionGenes.emplace_back(connectionGeneIn);
+		connectionGenes.emplace_back(connectionGeneOut);
+		indexConnectionGene(connectionGeneIn);
+		indexConnectionGene(connectionGeneOut);
 		mutationsInLastGeneration += "(added fg " + std::to_string(fieldGenes.back().getParameters().id) +
 			" and cgs innov's " + std::to_string(innovIn) + ", " + std::to_string(innovOut) + ")";
 	}
@@ -731,6 +788,7 @@ namespace neat_dnfs
 				GenomeMutationConstants::mutateConnectionGeneProbability)
 			{
 				connectionGene.mutate();
+				indexConnectionGene(connectionGene);
 				const std::string cg_id = connectionGene.getParameters().connectionTuple.toString();
 				mutationsInLastGeneration += "[cg " + cg_id + " " + connectionGene.getMutationsInLastGeneration() + "] ";
 			}
@@ -0,0 +1,204 @@
+#include "neat/kernel_parameters.h"
+
+#include <stdexcept>
+
+namespace neat_dnfs
+{
+	using namespace dnf_composer::element;
+
+	ElementLabel kernelLabelOf(const KernelParameters& parameters)
+	{
+		if (std::holds_alternative<GaussKernelParameters>(parameters))
+		{
+			return ElementLabel::GAUSS_KERNEL;
+		}
+		if (std::holds_alternative<MexicanHatKernelParameters>(parameters))
+		{
+			return ElementLabel::MEXICAN_HAT_KERNEL;
+		}
+		return ElementLabel::OSCILLATORY_KERNEL;
+	}
+
+	KernelParameters kernelParametersOf(const KernelPtr& kernel)
+	{
+		if (!kernel)
+		{
+			throw std::invalid_argument("kernelParametersOf() - kernel is nullptr.");
+		}
+
+		switch (kernel->getLabel())
+		{
+		case ElementLabel::GAUSS_KERNEL:
+			return std::dynamic_pointer_cast<GaussKernel>(kernel)->getParameters();
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+			return std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->getParameters();
+		case ElementLabel::OSCILLATORY_KERNEL:
+			return std::dynamic_pointer_cast<OscillatoryKernel>(kernel)->getParameters();
+		default:
+			throw std::invalid_argument("kernelParametersOf() - Kernel type not recognized.");
+		}
+	}
+
+	KernelPtr makeKernel(const ElementCommonParameters& commonParameters, const KernelParameters& parameters)
+	{
+		switch (kernelLabelOf(parameters))
+		{
+		case ElementLabel::GAUSS_KERNEL:
+			return std::make_shared<GaussKernel>(commonParameters, std::get<GaussKernelParameters>(parameters));
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+			return std::make_shared<MexicanHatKernel>(commonParameters, std::get<MexicanHatKernelParameters>(parameters));
+		default:
+			return std::make_shared<OscillatoryKernel>(commonParameters, std::get<OscillatoryKernelParameters>(parameters));
+		}
+	}
+
+	bool applyKernelParameters(const KernelPtr& kernel, const KernelParameters& parameters)
+	{
+		if (!kernel || kernel->getLabel() != kernelLabelOf(parameters))
+		{
+			return false;
+		}
+
+		switch (kernelLabelOf(parameters))
+		{
+		case ElementLabel::GAUSS_KERNEL:
+			std::dynamic_pointer_cast<GaussKernel>(kernel)->setParameters(std::get<GaussKernelParameters>(parameters));
+			break;
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+			std::dynamic_pointer_cast<MexicanHatKernel>(kernel)->setParameters(std::get<MexicanHatKernelParameters>(parameters));
+			break;
+		default:
+			std::dynamic_pointer_cast<OscillatoryKernel>(kernel)->setParameters(std::get<OscillatoryKernelParameters>(parameters));
+			break;
+		}
+		return true;
+	}
+
+	bool sameKernelParameters(const KernelParameters& a, const KernelParameters& b)
+	{
+		if (a.index() != b.index())
+		{
+			return false;
+		}
+
+		switch (kernelLabelOf(a))
+		{
+		case ElementLabel::GAUSS_KERNEL:
+		{
+			const auto& x = std::get<GaussKernelParameters>(a);
+			const auto& y = std::get<GaussKernelParameters>(b);
+			return x.width == y.width && x.amplitude == y.amplitude && x.amplitudeGlobal == y.amplitudeGlobal;
+		}
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+		{
+			const auto& x = std::get<MexicanHatKernelParameters>(a);
+			const auto& y = std::get<MexicanHatKernelParameters>(b);
+			return x.widthExc == y.widthExc && x.amplitudeExc == y.amplitudeExc &&
+				x.widthInh == y.widthInh && x.amplitudeInh == y.amplitudeInh &&
+				x.amplitudeGlobal == y.amplitudeGlobal;
+		}
+		default:
+		{
+			const auto& x = std::get<OscillatoryKernelParameters>(a);
+			const auto& y = std::get<OscillatoryKernelParameters>(b);
+			return x.amplitude == y.amplitude && x.decay == y.decay;
+		}
+		}
+	}
+
+	void hashKernelParameters(std::uint64_t& hash, const KernelParameters& parameters)
+	{
+		using tools::utils::hashCombine;
+
+		hashCombine(hash, static_cast<std::uint64_t>(kernelLabelOf(parameters)));
+		switch (kernelLabelOf(parameters))
+		{
+		case ElementLabel::GAUSS_KERNEL:
+		{
+			const auto& gkp = std::get<GaussKernelParameters>(parameters);
+			hashCombine(hash, gkp.width);
+			hashCombine(hash, gkp.amplitude);
+			hashCombine(hash, gkp.amplitudeGlobal);
+			break;
+		}
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+		{
+			const auto& mhkp = std::get<MexicanHatKernelParameters>(parameters);
+			hashCombine(hash, mhkp.widthExc);
+			hashCombine(hash, mhkp.amplitudeExc);
+			hashCombine(hash, mhkp.widthInh);
+			hashCombine(hash, mhkp.amplitudeInh);
+			hashCombine(hash, mhkp.amplitudeGlobal);
+			break;
+		}
+		default:
+		{
+			const auto& okp = std::get<OscillatoryKernelParameters>(parameters);
+			hashCombine(hash, okp.amplitude);
+			hashCombine(hash, okp.decay);
+			break;
+		}
+		}
+	}
+
+	void serializeKernelParameters(tools::BinaryWriter& writer, const KernelParameters& parameters)
+	{
+		writer.write(static_cast<std::int32_t>(kernelLabelOf(parameters)));
+		switch (kernelLabelOf(parameters))
+		{
+		case ElementLabel::GAUSS_KERNEL:
+		{
+			const auto& gkp = std::get<GaussKernelParameters>(parameters);
+			writer.write(gkp.width);
+			writer.write(gkp.amplitude);
+			writer.write(gkp.amplitudeGlobal);
+			writer.write(gkp.circular);
+			writer.write(gkp.normalized);
+			break;
+		}
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+		{
+			const auto& mhkp = std::get<MexicanHatKernelParameters>(parameters);
+			writer.write(mhkp.widthExc);
+			writer.write(mhkp.amplitudeExc);
+			writer.write(mhkp.widthInh);
+			writer.write(mhkp.amplitudeInh);
+			writer.write(mhkp.amplitudeGlobal);
+			writer.write(mhkp.circular);
+			writer.write(mhkp.normalized);
+			break;
+		}
+		default:
+			throw std::invalid_argument("serializeKernelParameters() - Oscillatory kernels can't be serialized.");
+		}
+	}
+
+	KernelParameters deserializeKernelParameters(tools::BinaryReader& reader)
+	{
+		switch (static_cast<ElementLabel>(reader.read<std::int32_t>()))
+		{
+		case ElementLabel::GAUSS_KERNEL:
+		{
+			const auto width = reader.read<double>();
+			const auto amplitude = reader.read<double>();
+			const auto amplitudeGlobal = reader.read<double>();
+			const auto circular = reader.read<bool>();
+			const auto normalized = reader.read<bool>();
+			return GaussKernelParameters{ width, amplitude, amplitudeGlobal, circular, normalized };
+		}
+		case ElementLabel::MEXICAN_HAT_KERNEL:
+		{
+			const auto widthExc = reader.read<double>();
+			const auto amplitudeExc = reader.read<double>();
+			const auto widthInh = reader.read<double>();
+			const auto amplitudeInh = reader.read<double>();
+			const auto amplitudeGlobal = reader.read<double>();
+			const auto circular = reader.read<bool>();
+			const auto normalized = reader.read<bool>();
+			return MexicanHatKernelParameters{ widthExc, amplitudeExc, widthInh, amplitudeInh, amplitudeGlobal, circular, normalized };
+		}
+		default:
+			throw std::runtime_error("deserializeKernelParameters() - Unknown kernel type.");
+		}
+	}
+}
@@ -4,9 +4,13 @@
 #include <algorithm>
 #include <cassert>
 #include <format>
-#include <atomic>
-#include <thread>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace neat_dnfs
 {
@@ -69,9 +73,48 @@ namespace neat_dnfs
 		: pause(pause), stop(stop)
 	{}
 
+	namespace
+	{
+		// Keys that tell a solution's evaluation stream from its mutation stream.
+		enum class RandomStream : std::uint64_t
+		{
+			Evaluation = 1,
+			Mutation = 2,
+			NoiseTape = 3,
+			Validation = 4
+		};
+
+		// Key of a connection gene for validateUniqueGenesInGenome().
+		struct ConnectionKey
+		{
+			int inFieldGeneId;
+			int outFieldGeneId;
+			int innovationNumber;
+
+			bool operator==(const ConnectionKey&) const = default;
+		};
+
+		struct ConnectionKeyHash
+		{
+			size_t operator()(const ConnectionKey& key) const
+			{
+				std::uint64_t hash = 0;
+				tools::utils::hashCombine(hash, static_cast<std::uint64_t>(key.inFieldGeneId));
+				tools::utils::hashCombine(hash, static_cast<std::uint64_t>(key.outFieldGeneId));
+				tools::utils::hashCombine(hash, static_cast<std::uint64_t>(key.innovationNumber));
+				return static_cast<size_t>(hash);
+			}
+		};
+	}
+
 	Population::Population(const PopulationParameters& parameters, const SolutionPtr& initialSolution, const bool enableFileIO)
-		: parameters(parameters)
+		: parameters(parameters), fitnessCache(parameters.fitnessCachePolicy, parameters.fitnessCacheSamples)
 	{
+		if (parameters.seed)
+		{
+			seededEngine = std::make_unique<tools::utils::Xoshiro256pp>(*parameters.seed);
+		}
+		validationSeed = parameters.seed ? *parameters.seed : std::random_device{}();
 		createInitialSolutions(initialSolution);
 		if (enableFileIO)
 		{
@@ -96,20 +139,38 @@ namespace neat_dnfs
 
 	void Population::initialize() const
 	{
+		std::optional<tools::utils::ScopedEngine> seeded;
+		if (seededEngine)
+		{
+			seeded.emplace(*seededEngine);
+		}
 		buildInitialSolutionsGenome();
 	}
 
 	void Population::startup()
 	{
 		statistics.start = std::chrono::steady_clock::now();
-		if (fileManager)
+		if (fileManager && !fileManager->hasFileDirectory())
 		{
 			fileManager->setFileDirectory();
 		}
+		if constexpr (tools::profilingEnabled)
+		{
+			// Whatever was timed before this run (another population, setup)
+			// doesn't belong to its first generation.
+			auto& profiler = tools::Profiler::instance();
+			profiler.collect();
+			profiler.setTracing(parameters.tracePhases && fileManager);
+		}
 	}
 
 	void Population::evolve()
 	{
+		std::optional<tools::utils::ScopedEngine> seeded;
+		if (seededEngine)
+		{
+			seeded.emplace(*seededEngine);
+		}
 		startup();
 
 		do
@@ -126,68 +187,213 @@ namespace neat_dnfs
 				tools::logger::log(tools::logger::LogLevel::INFO, "Evolution paused.");
 			}
 
+			checkpoint();
+			collectPhaseProfile();
+
 		} while (!endConditionMet());
 
 		cleanup();
 	}
 
-	void Population::evaluate() const
+	void Population::evaluate()
 	{
-		const size_t solutionCount = solutions.size();
-		const unsigned hardwareConcurrency = std::max(1U, std::thread::hardware_concurrency());
-		const size_t numWorkers = std::min<size_t>(hardwareConcurrency, solutionCount);
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::Evaluate);
+		// Unchanged genomes (elites, carried-over champions, unmutated offspring)
+		// get their fitness back from the cache; only the rest is simulated.
+		const std::vector<SolutionPtr> pending = fitnessCache.restore(solutions);
+		const auto noiseTape = makeGenerationNoiseTape();
+		for (const auto& solution : pending)
+		{
+			solution->setEarlyTerminationThreshold(earlyTerminationThreshold);
+			solution->setNoiseTape(noiseTape);
+		}
+		if (parameters.parallelEvolution && !executor)
+		{
+			// Created on first use so an executor injected with setExecutor()
+			// never has a throwaway pool built alongside it.
+			executor = std::make_shared<tools::ThreadPool>(static_cast<size_t>(std::max(0, parameters.numThreads)), parameters.pinThreads);
+		}
+		evaluateSolutions(pending);
 
-		if (!parameters.parallelEvolution || numWorkers <= 1)
+		perGenStatistics.truncatedEvaluations = static_cast<int>(std::ranges::count_if(pending,
+			[](const SolutionPtr& solution) { return solution->getParameters().evaluationTruncated; }));
+		perGenStatistics.earlyTerminationThreshold = earlyTerminationThreshold;
+		perGenStatistics.savedSimulationSteps = 0;
+		for (const auto& solution : pending)
 		{
-			for (const auto& solution : solutions)
-			{
-				solution->evaluate();
-			}
+			perGenStatistics.savedSimulationSteps += solution->getParameters().savedSimulationSteps;
+		}
+		fitnessCache.record(pending);
+		updateEarlyTerminationThreshold();
+	}
+
+	void Population::updateEarlyTerminationThreshold()
+	{
+		if (parameters.earlyTerminationPolicy == EarlyTerminationPolicy::Disabled || solutions.empty())
+		{
+			earlyTerminationThreshold = -std::numeric_limits<double>::infinity();
 			return;
 		}
 
-		std::atomic<size_t> nextIndex{ 0 };
-		std::vector<std::future<void>> futures;
-		futures.reserve(numWorkers);
-		for (size_t w = 0; w < numWorkers; ++w)
+		// Species prune their own members, so this population-wide rank is only
+		// an estimate of who survives; a solution that falls short of it is
+		// still ranked, by the fitness of the phases it did run.
+		std::vector<double> fitness;
+		fitness.reserve(solutions.size());
+		for (const auto& solution : solutions)
 		{
-			futures.emplace_back(std::async(std::launch::async, [this, &nextIndex, solutionCount]()
+			fitness.push_back(solution->getFitness());
+		}
+		const auto pruned = static_cast<size_t>(static_cast<double>(fitness.size()) * PopulationConstants::pruneRatio);
+		const size_t kept = std::max<size_t>(1, fitness.size() - std::min(pruned, fitness.size()));
+		std::ranges::nth_element(fitness, fitness.begin() + static_cast<std::ptrdiff_t>(kept - 1), std::greater<>());
+		earlyTerminationThreshold = fitness[kept - 1];
+	}
+
+	void Population::evaluateSolutions(const std::vector<SolutionPtr>& pending)
+	{
+		// Offspring (age 0) share no elements with the phenotypes the file
+		// manager exported last generation, so they are simulated right away.
+		// Survivors carried over unchanged may still be read by the background
+		// writer and wait for flush(). Species assignment only looks at
+		// genomes, so it runs on this thread while the pool simulates.
+		//
+		// It does write each solution's species id while a worker may be
+		// evaluating that solution. That doesn't race: evaluate() only writes
+		// the fitness, partial fitness, truncation and saved-step members of
+		// SolutionParameters, never speciesId or the whole struct, and both
+		// sides only read the genome.
+		std::vector<SolutionPtr> offspring;
+		std::vector<SolutionPtr> survivors;
+		for (const auto& solution : pending)
+		{
+			(solution->getAge() == 0 ? offspring : survivors).push_back(solution);
+		}
+
+		const auto overlappedWork = [this](const bool poolIsIdle)
+			{
+				assignSolutionsToSpecies(poolIsIdle);
+				solutionsAssignedToSpecies = true;
+				if (fileManager)
 				{
-					for (size_t i = nextIndex.fetch_add(1); i < solutionCount; i = nextIndex.fetch_add(1))
-					{
-						solutions[i]->evaluate();
-					}
-				}));
+					fileManager->flush();
+				}
+			};
+
+		if (!parameters.parallelEvolution || !executor || executor->size() <= 1 || pending.size() <= 1)
+		{
+			runEvaluations(offspring);
+			overlappedWork(true);
+			runEvaluations(survivors);
+			return;
 		}
 
-		std::exception_ptr firstError;
-		for (auto& future : futures)
+		tools::TaskGroup group;
+		const auto submit = [this, &group](const std::vector<SolutionPtr>& batch)
+			{
+				for (const auto& solution : batch)
+				{
+					executor->submit(group, [this, solution]() { evaluateSolution(solution); });
+				}
+			};
+
+		submit(offspring);
+		try
+		{
+			// The pool is busy with the offspring: speciating on it would
+			// queue behind them, and its wait would run evaluations on this
+			// thread's stack.
+			overlappedWork(false);
+		}
+		catch (...)
 		{
+			// The tasks reference the group, so it must drain before unwinding;
+			// the main-thread failure is the one worth reporting.
 			try
 			{
-				future.get();
+				executor->wait(group);
 			}
 			catch (...)
 			{
-				if (!firstError)
-				{
-					firstError = std::current_exception();
-				}
+				tools::logger::log(tools::logger::LogLevel::ERROR, "An evaluation also failed while handling another exception.");
 			}
+			throw;
+		}
+		submit(survivors);
+		// The first exception thrown by any evaluation is rethrown once all finish.
+		executor->wait(group);
+	}
+
+	void Population::runEvaluations(const std::vector<SolutionPtr>& batch) const
+	{
+		for (const auto& solution : batch)
+		{
+			evaluateSolution(solution);
+		}
+	}
+
+	void Population::evaluateSolution(const SolutionPtr& solution) const
+	{
+		if (!parameters.seed)
+		{
+			solution->evaluate();
+			return;
 		}
+		tools::utils::Xoshiro256pp stream{ tools::utils::streamSeed(*parameters.seed,
+			{ static_cast<std::uint64_t>(RandomStream::Evaluation),
+			static_cast<std::uint64_t>(parameters.currentGeneration),
+			static_cast<std::uint64_t>(solution->getId()) }) };
+		tools::utils::ScopedEngine scope(stream);
+		solution->evaluate();
+	}
 
-		if (firstError)
+	void Population::mutateSolution(const SolutionPtr& solution) const
+	{
+		if (!parameters.seed)
 		{
-			std::rethrow_exception(firstError);
+			solution->mutate();
+			return;
 		}
+		tools::utils::Xoshiro256pp stream{ tools::utils::streamSeed(*parameters.seed,
+			{ static_cast<std::uint64_t>(RandomStream::Mutation),
+			static_cast<std::uint64_t>(parameters.currentGeneration),
+			static_cast<std::uint64_t>(solution->getId()) }) };
+		tools::utils::ScopedEngine scope(stream);
+		solution->mutate();
+	}
+
+	tools::utils::Xoshiro256pp& Population::randomEngine() const
+	{
+		return seededEngine ? *seededEngine : tools::utils::engine();
+	}
+
+	std::shared_ptr<const tools::NoiseTape> Population::makeGenerationNoiseTape() const
+	{
+		if (parameters.noiseSource != NoiseSource::GenerationTape)
+		{
+			return nullptr;
+		}
+		// Seeded runs derive the tape's seed from the run seed rather than
+		// drawing it from the population's engine, so switching noise sources
+		// doesn't shift any other draw. Unseeded runs do draw it from the
+		// engine, which has no reproducible sequence to protect.
+		const std::uint64_t seed = parameters.seed
+			? tools::utils::streamSeed(*parameters.seed,
+				{ static_cast<std::uint64_t>(RandomStream::NoiseTape),
+				static_cast<std::uint64_t>(parameters.currentGeneration) })
+			: randomEngine()();
+		return std::make_shared<const tools::NoiseTape>(NoiseConstants::tapeSteps,
+			static_cast<size_t>(DimensionConstants::xSize), seed);
 	}
 
 	void Population::speciate()
 	{
-		for (const auto& solution : solutions)
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::Speciate);
+		if (!solutionsAssignedToSpecies)
 		{
-			assignToSpecies(solution);
+			assignSolutionsToSpecies(true);
 		}
+		solutionsAssignedToSpecies = false;
 
 		// A species that lost all its members to reassignment this generation is
 		// not touched again until crossover() runs later in reproduceAndSelect(),
@@ -206,16 +412,72 @@ namespace neat_dnfs
 			species->assignChampion();
 		}
 
-		if (validationPolicy == ValidationPolicy::Throw)
+		if (activeValidationMode() != ValidationMode::Off)
 		{
+			NEAT_DNFS_PROFILE_PHASE(tools::Phase::Validation);
 			validateAssignmentIntoSpecies();
 		}
 
 		calculateAdjustedFitness();
 	}
 
+	void Population::assignSolutionsToSpecies(const bool useExecutor)
+	{
+		if (!useExecutor || !parameters.parallelEvolution || !executor || executor->size() <= 1 || solutions.size() <= 1 || speciesList.empty())
+		{
+			for (const auto& solution : solutions)
+			{
+				assignToSpecies(solution);
+			}
+			return;
+		}
+
+		// Compatibility against the species that exist when the pass starts is
+		// computed up front on the pool: for every solution, the index of the
+		// first live species whose current representative it is compatible with
+		// (numSpecies if none). The serial pass below then replays the usual
+		// first-compatible rule against those answers, so the result is the same
+		// as the serial path -- only species created during the pass, or whose
+		// representative left and was replaced, are evaluated on the fly.
+		const size_t numSpecies = speciesList.size();
+		std::vector<SolutionPtr> representatives(numSpecies);
+		for (size_t s = 0; s < numSpecies; ++s)
+		{
+			representatives[s] = speciesList[s]->getRepresentative();
+		}
+
+		std::vector<size_t> firstCompatible(solutions.size(), numSpecies);
+		executor->parallelFor(solutions.size(), [this, numSpecies, &firstCompatible](const size_t i)
+			{
+				for (size_t s = 0; s < numSpecies; ++s)
+				{
+					if (!speciesList[s]->isExtinct() && speciesList[s]->isCompatible(solutions[i]))
+					{
+						firstCompatible[i] = s;
+						return;
+					}
+				}
+			});
+
+		for (size_t i = 0; i < solutions.size(); ++i)
+		{
+			const size_t first = firstCompatible[i];
+			assignToSpecies(solutions[i], [&, first](const size_t s, const Species& species)
+				{
+					// Precomputed answers are only known up to the first match, and
+					// only while the representative is the one they were computed for.
+					if (s < numSpecies && s <= first && species.getRepresentative() == representatives[s])
+					{
+						return s == first;
+					}
+					return species.isCompatible(solutions[i]);
+				});
+		}
+	}
+
 	void Population::reproduceAndSelect()
 	{
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::ReproduceAndSelect);
 		assignOffspringToSpecies();
 
 		if (PopulationConstants::logSpecies)
@@ -230,6 +492,7 @@ namespace neat_dnfs
 
 	void Population::upkeep()
 	{
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::Upkeep);
 		upkeepBestSolution();
 		upkeepChampions();
 		upkeepPerGenerationStatistics();
@@ -247,14 +510,14 @@ namespace neat_dnfs
 			logSpecies();
 		}
 
-		if (validationPolicy == ValidationPolicy::Throw)
+		if (activeValidationMode() != ValidationMode::Off)
 		{
+			NEAT_DNFS_PROFILE_PHASE(tools::Phase::Validation);
 			validatePopulationSize();
 			validateIfSpeciesHaveUniqueRepresentative();
 			validateUniqueSolutions();
 			validateElitism();
 			validateUniqueGenesInGenomes();
-			validateUniqueKernelAndNeuralFieldPtrs();
 		}
 
 		if (fileManager)
@@ -281,9 +544,289 @@ namespace neat_dnfs
 		if (fileManager)
 		{
 			fileManager->saveEndOfRunData();
+			if (tools::profilingEnabled && parameters.tracePhases)
+			{
+				fileManager->savePhaseTrace();
+			}
+			fileManager->flush();
+		}
+		if constexpr (tools::profilingEnabled)
+		{
+			auto& profiler = tools::Profiler::instance();
+			profiler.setTracing(false);
+			profiler.clearTrace();
+		}
+	}
+
+	void Population::collectPhaseProfile()
+	{
+		if constexpr (tools::profilingEnabled)
+		{
+			phaseProfile = tools::Profiler::instance().collect();
+			if (fileManager)
+			{
+				fileManager->savePhaseProfile();
+			}
+		}
+	}
+
+
+	void Population::checkpoint() const
+	{
+		if (!fileManager || parameters.checkpointInterval <= 0 ||
+			parameters.currentGeneration % parameters.checkpointInterval != 0)
+		{
+			return;
+		}
+		// A failed checkpoint costs the ability to resume from this
+		// generation, not the run itself.
+		try
+		{
+			fileManager->saveCheckpoint();
+		}
+		catch (const std::exception& error)
+		{
+			log(tools::logger::LogLevel::ERROR, std::format("Failed to save checkpoint: {}", error.what()));
+		}
+	}
+
+	namespace
+	{
+		constexpr std::array<char, 8> checkpointMagic{ 'N', 'D', 'F', 'S', 'C', 'K', 'P', 'T' };
+		constexpr std::uint32_t checkpointVersion = 1;
+	}
+
+	void Population::writeCheckpoint(std::ostream& out) const
+	{
+		tools::BinaryWriter writer(out);
+		writer.write(checkpointMagic);
+		writer.write(checkpointVersion);
+		writer.writeString(solutions.front()->getName());
+		writer.write(static_cast<std::int32_t>(parameters.size));
+		writer.write(static_cast<std::int32_t>(parameters.currentGeneration));
+		writer.write(static_cast<std::int32_t>(Solution::getUniqueIdentifierCounter()));
+		writer.write(static_cast<std::int32_t>(Species::getUniqueIdentifierCounter()));
+		writer.write(static_cast<std::int32_t>(Genome::getGlobalInnovationNumber()));
+		writer.write(randomEngine().getState());
+
+		// A solution can be in the population, a species and the best-solution
+		// bookkeeping at once, so each is written once and referred to by index.
+		std::vector<SolutionPtr> table;
+		std::unordered_map<const Solution*, std::int32_t> indices;
+		const auto collect = [&table, &indices](const SolutionPtr& solution)
+			{
+				if (solution != nullptr && indices.emplace(solution.get(), static_cast<std::int32_t>(table.size())).second)
+				{
+					table.push_back(solution);
+				}
+			};
+		for (const auto& solution : solutions)
+		{
+			collect(solution);
+		}
+		for (const auto& species : speciesList)
+		{
+			collect(species->getRepresentative());
+			collect(species->getChampion());
+			for (const auto& member : species->getMembers())
+			{
+				collect(member);
+			}
+		}
+		collect(bestSolution);
+		for (const auto& champion : champions)
+		{
+			collect(champion);
+		}
+		collect(previousBestSolution);
+		const auto indexOf = [&indices](const SolutionPtr& solution) -> std::int32_t
+			{
+				return solution == nullptr ? -1 : indices.at(solution.get());
+			};
+
+		writer.write(static_cast<std::uint64_t>(table.size()));
+		for (const auto& solution : table)
+		{
+			solution->serialize(writer);
+		}
+		writer.write(static_cast<std::uint64_t>(solutions.size()));
+		for (const auto& solution : solutions)
+		{
+			writer.write(indexOf(solution));
+		}
+		writer.write(static_cast<std::uint64_t>(speciesList.size()));
+		for (const auto& species : speciesList)
+		{
+			species->serialize(writer, indexOf);
+		}
+		writer.write(indexOf(bestSolution));
+		writer.write(static_cast<std::uint64_t>(champions.size()));
+		for (const auto& champion : champions)
+		{
+			writer.write(indexOf(champion));
+		}
+		writer.write(indexOf(previousBestSolution));
+
+		writer.write(hasFitnessImproved);
+		writer.write(static_cast<std::int32_t>(generationsWithoutImprovement));
+		writer.write(previousBestFitness);
+		writer.write(earlyTerminationThreshold);
+		writer.write(perGenStatistics);
+		writer.writeVector(bestFitnessHistory);
+		writer.writeVector(bestSolutionIdHistory);
+		writer.write(static_cast<std::uint64_t>(bestSolutionGenomeHistory.size()));
+		for (const auto& genome : bestSolutionGenomeHistory)
+		{
+			genome.serialize(writer);
+		}
+		fitnessCache.serialize(writer);
+
+		if (!out)
+		{
+			throw std::runtime_error("Failed to write checkpoint.");
 		}
 	}
 
+	void Population::readCheckpoint(std::istream& in)
+	{
+		tools::BinaryReader reader(in);
+		if (reader.read<std::array<char, 8>>() != checkpointMagic)
+		{
+			throw std::runtime_error("Not a checkpoint.");
+		}
+		if (const auto version = reader.read<std::uint32_t>(); version != checkpointVersion)
+		{
+			throw std::runtime_error(std::format("Unsupported checkpoint version {}.", version));
+		}
+		const SolutionPtr prototype = solutions.front();
+		if (const std::string task = reader.readString(); task != prototype->getName())
+		{
+			throw std::runtime_error(std::format("Checkpoint of task '{}' can't resume a population of task '{}'.", task, prototype->getName()));
+		}
+		if (const int size = reader.read<std::int32_t>(); size != parameters.size)
+		{
+			throw std::runtime_error(std::format("Checkpoint of a population of {} can't resume a population of {}.", size, parameters.size));
+		}
+		const int currentGeneration = reader.read<std::int32_t>();
+		const int solutionCounter = reader.read<std::int32_t>();
+		const int speciesCounter = reader.read<std::int32_t>();
+		const int innovationNumber = reader.read<std::int32_t>();
+		const auto engineState = reader.read<tools::utils::Xoshiro256pp::State>();
+
+		// Everything is read into locals first, so a corrupt checkpoint leaves
+		// the population as it was.
+		std::vector<SolutionPtr> table(reader.readSequenceSize(sizeof(Solution)));
+		for (auto& solution : table)
+		{
+			solution = prototype->clone();
+			solution->deserialize(reader);
+		}
+		const auto readSolution = [&reader, &table]() -> SolutionPtr
+			{
+				const auto index = reader.read<std::int32_t>();
+				if (index == -1)
+				{
+					return nullptr;
+				}
+				if (index < 0 || static_cast<size_t>(index) >= table.size())
+				{
+					throw std::runtime_error(std::format("Corrupt checkpoint: solution index {}.", index));
+				}
+				return table[index];
+			};
+
+		std::vector<SolutionPtr> restoredSolutions(reader.readSequenceSize(sizeof(std::int32_t)));
+		for (auto& solution : restoredSolutions)
+		{
+			solution = readSolution();
+			if (solution == nullptr)
+			{
+				throw std::runtime_error("Corrupt checkpoint: missing solution.");
+			}
+		}
+		std::vector<std::shared_ptr<Species>> restoredSpecies(reader.readSequenceSize(sizeof(Species)));
+		for (auto& species : restoredSpecies)
+		{
+			species = Species::deserialize(reader, table);
+		}
+		const SolutionPtr restoredBestSolution = readSolution();
+		std::vector<SolutionPtr> restoredChampions(reader.readSequenceSize(sizeof(std::int32_t)));
+		for (auto& champion : restoredChampions)
+		{
+			champion = readSolution();
+		}
+		const SolutionPtr restoredPreviousBestSolution = readSolution();
+		if (restoredSolutions.empty() || restoredBestSolution == nullptr)
+		{
+			throw std::runtime_error("Corrupt checkpoint: empty population.");
+		}
+
+		const bool restoredHasFitnessImproved = reader.read<bool>();
+		const int restoredGenerationsWithoutImprovement = reader.read<std::int32_t>();
+		const auto restoredPreviousBestFitness = reader.read<double>();
+		const auto restoredEarlyTerminationThreshold = reader.read<double>();
+		const auto restoredPerGenStatistics = reader.read<PerGenerationStatistics>();
+		std::vector<double> restoredBestFitnessHistory = reader.readVector<double>();
+		std::vector<int> restoredBestSolutionIdHistory = reader.readVector<int>();
+		std::vector<Genome> restoredBestSolutionGenomeHistory(reader.readSequenceSize(sizeof(Genome)));
+		for (auto& genome : restoredBestSolutionGenomeHistory)
+		{
+			genome.deserialize(reader);
+		}
+		FitnessCache restoredFitnessCache(parameters.fitnessCachePolicy, parameters.fitnessCacheSamples);
+		restoredFitnessCache.deserialize(reader);
+
+		parameters.currentGeneration = currentGeneration;
+		solutions = std::move(restoredSolutions);
+		speciesList = std::move(restoredSpecies);
+		bestSolution = restoredBestSolution;
+		champions = std::move(restoredChampions);
+		previousBestSolution = restoredPreviousBestSolution;
+		hasFitnessImproved = restoredHasFitnessImproved;
+		generationsWithoutImprovement = restoredGenerationsWithoutImprovement;
+		previousBestFitness = restoredPreviousBestFitness;
+		earlyTerminationThreshold = restoredEarlyTerminationThreshold;
+		perGenStatistics = restoredPerGenStatistics;
+		bestFitnessHistory = std::move(restoredBestFitnessHistory);
+		bestSolutionIdHistory = std::move(restoredBestSolutionIdHistory);
+		bestSolutionGenomeHistory = std::move(restoredBestSolutionGenomeHistory);
+		fitnessCache = std::move(restoredFitnessCache);
+		solutionsAssignedToSpecies = false;
+
+		// Restored last: cloning the solutions above advanced them.
+		Solution::setUniqueIdentifierCounter(solutionCounter);
+		Species::setUniqueIdentifierCounter(speciesCounter);
+		Genome::setGlobalInnovationNumber(innovationNumber);
+		Genome::clearGenerationalInnovations();
+		randomEngine().setState(engineState);
+	}
+
+	void Population::saveCheckpoint(const std::string& filePath) const
+	{
+		std::ostringstream out(std::ios::binary);
+		writeCheckpoint(out);
+		tools::writeFileAtomically(filePath, std::move(out).str());
+	}
+
+	void Population::loadCheckpoint(const std::string& filePath)
+	{
+		std::ifstream in(filePath, std::ios::binary);
+		if (!in.is_open())
+		{
+			throw std::runtime_error(std::format("Failed to open checkpoint {}.", filePath));
+		}
+		readCheckpoint(in);
+	}
+
+	void Population::resumeFrom(const std::string& directory)
+	{
+		loadCheckpoint((std::filesystem::path(directory) / PopulationConstants::checkpointFileName).string());
+		if (fileManager)
+		{
+			fileManager->setFileDirectory(directory);
+		}
+		log(tools::logger::LogLevel::INFO, std::format("Resumed {} at generation {}.", directory, parameters.currentGeneration));
+	}
 
 	void Population::createInitialSolutions(const SolutionPtr& initialSolution)
 	{
@@ -411,6 +954,10 @@ namespace neat_dnfs
 			perGenStatistics.averageFieldGenes += static_cast<double>(solution->getNumFieldGenes());
 		}
 		perGenStatistics.averageFieldGenes /= static_cast<double>(solutions.size());
+
+		// fitness cache
+		perGenStatistics.fitnessCacheHits = fitnessCache.getHits();
+		perGenStatistics.fitnessCacheMisses = fitnessCache.getMisses();
 	}
 
 
@@ -431,14 +978,23 @@ namespace neat_dnfs
 	}	
 
 	void Population::assignToSpecies(const SolutionPtr& solution)
+	{
+		assignToSpecies(solution, [&solution](size_t, const Species& species)
+			{
+				return species.isCompatible(solution);
+			});
+	}
+
+	void Population::assignToSpecies(const SolutionPtr& solution, const std::function<bool(size_t, const Species&)>& isCompatible)
 	{
 		bool assigned = false;
 		const std::shared_ptr<Species> currentSpecies = findSpecies(solution);
-		for (const auto& species : speciesList)
+		for (size_t index = 0; index < speciesList.size(); ++index)
 		{
+			const auto species = speciesList[index];
 			if (!species->isExtinct())
 			{
-				if (species->isCompatible(solution))
+				if (isCompatible(index, *species))
 				{
 					if (currentSpecies != species) 
 					{
@@ -818,6 +1374,8 @@ namespace neat_dnfs
 	{
 		upkeepBestSolution();
 		upkeepChampions();
+		std::vector<SolutionPtr> toMutate;
+		toMutate.reserve(solutions.size());
 		for (const auto& solution : solutions)
 		{
 			// if champion, do not mutate
@@ -825,9 +1383,26 @@ namespace neat_dnfs
 																 [&solution](const auto& champion)
 																 { return champion == solution; }))
 			{
-				solution->mutate();
+				toMutate.push_back(solution);
 			}
 		}
+
+		// Offspring are independent deep copies and innovation numbers are
+		// handed out under Genome's lock, so mutation parallelizes like evaluation.
+		// Seeded runs mutate in population order instead: the order new
+		// connections reach that lock decides their innovation numbers.
+		if (!parameters.seed && parameters.parallelEvolution && executor && executor->size() > 1 && toMutate.size() > 1)
+		{
+			executor->parallelFor(toMutate.size(), [&toMutate](const size_t i)
+				{
+					toMutate[i]->mutate();
+				});
+			return;
+		}
+		for (const auto& solution : toMutate)
+		{
+			mutateSolution(solution);
+		}
 	}
 
 	bool Population::endConditionMet() const
@@ -875,17 +1450,21 @@ namespace neat_dnfs
 			previousBestFitness, bestFitness));
 	}
 
+	ValidationMode Population::activeValidationMode() const
+	{
+		return validationPolicy == ValidationPolicy::Throw ? ValidationMode::Full : parameters.validationMode;
+	}
+
 	void Population::validateUniqueSolutions()
 	{
+		std::unordered_set<const Solution*> seen;
+		seen.reserve(solutions.size());
 		int counter = 0;
-		for (size_t i = 0; i < solutions.size(); ++i)
+		for (const auto& solution : solutions)
 		{
-			for (size_t j = i + 1; j < solutions.size(); ++j)
+			if (!seen.insert(solution.get()).second)
 			{
-				if (solutions[i] == solutions[j])
-				{
-					counter++;
-				}
+				counter++;
 			}
 		}
 		if(counter > 0)
@@ -905,106 +1484,67 @@ namespace neat_dnfs
 
 	void Population::validateUniqueGenesInGenomes()
 	{
-		for (const auto& solution : solutions)
+		const auto sampleSize = static_cast<size_t>(std::max(0, parameters.validationSampleSize));
+		if (activeValidationMode() == ValidationMode::Full || solutions.size() <= sampleSize)
 		{
-			const auto& genome = solution->getGenome();
-			const auto& connectionGenes = genome.getConnectionGenes();
-			for (auto const& connectionGene1 : connectionGenes)
+			for (const auto& solution : solutions)
 			{
-				for (auto const& connectionGene2 : connectionGenes)
-				{
-					if (connectionGene1 != connectionGene2)
-					{
-						if (connectionGene1.getInFieldGeneId() == connectionGene2.getInFieldGeneId() &&
-							connectionGene1.getOutFieldGeneId() == connectionGene2.getOutFieldGeneId() &&
-							connectionGene1.getInnovationNumber() == connectionGene2.getInnovationNumber())
-						{
-							const auto inFieldGeneId = connectionGene1.getInFieldGeneId();
-							const auto outFieldGeneId = connectionGene1.getOutFieldGeneId();
-							const auto innovationNumber = connectionGene1.getInnovationNumber();
-							reportViolation(ValidationCheck::UniqueGenesInGenomes, std::format(
-								"Connection genes are the same. InFieldGeneId: {} OutFieldGeneId: {} InnovationNumber: {}",
-								inFieldGeneId, outFieldGeneId, innovationNumber));
-						}
-					}
-				}
+				validateUniqueGenesInGenome(*solution);
 			}
+			return;
 		}
-	}
 
-	void Population::validateUniqueKernelAndNeuralFieldPtrs()
-	{
-		for (const auto& solution_a : solutions)
+		// A fresh subset every generation, so a fault that persists is caught
+		// within a few generations without checking every genome each time.
+		tools::utils::Xoshiro256pp stream{ tools::utils::streamSeed(validationSeed,
+			{ static_cast<std::uint64_t>(RandomStream::Validation),
+			static_cast<std::uint64_t>(parameters.currentGeneration) }) };
+		std::vector<SolutionPtr> sample;
+		sample.reserve(sampleSize);
+		std::ranges::sample(solutions, std::back_inserter(sample), static_cast<std::ptrdiff_t>(sampleSize), stream);
+		for (const auto& solution : sample)
 		{
-			const auto& genome_a = solution_a->getGenome();
-			const auto& connectionGenes_a = genome_a.getConnectionGenes();
-			const auto& fieldGenes_a = genome_a.getFieldGenes();
+			validateUniqueGenesInGenome(*solution);
+		}
+	}
 
-			for (const auto& solution_b : solutions)
+	void Population::validateUniqueGenesInGenome(const Solution& solution)
+	{
+		const auto& connectionGenes = solution.getGenome().getConnectionGenes();
+		std::unordered_set<ConnectionKey, ConnectionKeyHash> seen;
+		seen.reserve(connectionGenes.size());
+		for (const auto& connectionGene : connectionGenes)
+		{
+			const ConnectionKey key{ connectionGene.getInFieldGeneId(),
+				connectionGene.getOutFieldGeneId(), connectionGene.getInnovationNumber() };
+			if (!seen.insert(key).second)
 			{
-				if (solution_a == solution_b)
-				{
-					continue;
-				}
-
-				const auto& genome_b = solution_b->getGenome();
-				const auto& connectionGenes_b = genome_b.getConnectionGenes();
-				const auto& fieldGenes_b = genome_b.getFieldGenes();
-
-				for (const auto& connectionGene_a : connectionGenes_a)
-				{
-					for (const auto& connectionGene_b : connectionGenes_b)
-					{
-						const auto kernel_a = connectionGene_a.getKernel();
-						const auto kernel_b = connectionGene_b.getKernel();
-						if (kernel_a == kernel_b)
-						{
-							reportViolation(ValidationCheck::UniqueKernelAndNeuralFieldPtrs, "Kernels are the same.");
-						}
-					}
-				}
-
-				for (const auto& fieldGene_a : fieldGenes_a)
-				{
-					for (const auto& fieldGene_b : fieldGenes_b)
-					{
-						const auto neuralField_a = fieldGene_a.getNeuralField();
-						const auto neuralField_b = fieldGene_b.getNeuralField();
-						if (neuralField_a == neuralField_b)
-						{
-							reportViolation(ValidationCheck::UniqueKernelAndNeuralFieldPtrs, "Neural fields are the same.");
-						}
-					}
-				}
-
+				reportViolation(ValidationCheck::UniqueGenesInGenomes, std::format(
+					"Connection genes are the same. InFieldGeneId: {} OutFieldGeneId: {} InnovationNumber: {}",
+					key.inFieldGeneId, key.outFieldGeneId, key.innovationNumber));
 			}
 		}
 	}
 
 	void Population::validateIfSpeciesHaveUniqueRepresentative()
 	{
-		for (const auto& species_a : speciesList)
+		std::unordered_map<const Solution*, const Species*> representedSpecies;
+		representedSpecies.reserve(speciesList.size());
+		for (const auto& species : speciesList)
 		{
-			for (const auto& species_b : speciesList)
+			if (species->isExtinct())
 			{
-				if (species_a->getId() == species_b->getId())
-				{
-					continue;
-				}
-				if (species_a->isExtinct() || species_b->isExtinct())
-				{
-					continue;
-				}
-
-				const auto representative_a = species_a->getRepresentative()->getAddress();
-				const auto representative_b = species_b->getRepresentative()->getAddress();
+				continue;
+			}
 
-				if (representative_a == representative_b)
-				{
-					reportViolation(ValidationCheck::SpeciesHaveUniqueRepresentative, std::format(
-						"Species have the same representative. Species a id: {} Representative a id: {} Species b id: {} Representative b id: {}",
-						species_a->getId(), representative_a, species_b->getId(), representative_b));
-				}
+			const auto& representative = species->getRepresentative();
+			const auto [it, inserted] = representedSpecies.emplace(representative.get(), species.get());
+			if (!inserted)
+			{
+				const auto address = representative->getAddress();
+				reportViolation(ValidationCheck::SpeciesHaveUniqueRepresentative, std::format(
+					"Species have the same representative. Species a id: {} Representative a id: {} Species b id: {} Representative b id: {}",
+					it->second->getId(), address, species->getId(), address));
 			}
 		}
 	}
@@ -1028,15 +1568,14 @@ namespace neat_dnfs
 				parameters.size, speciesSolutions.size()));
 		}
 
+		std::unordered_set<const Solution*> seen;
+		seen.reserve(speciesSolutions.size());
 		int counter = 0;
-		for (size_t i = 0; i < speciesSolutions.size(); ++i)
+		for (const auto& solution : speciesSolutions)
 		{
-			for (size_t j = i + 1; j < speciesSolutions.size(); ++j)
+			if (!seen.insert(solution.get()).second)
 			{
-				if (speciesSolutions[i] == speciesSolutions[j])
-				{
-					counter++;
-				}
+				counter++;
 			}
 		}
 		if (counter > 0)
@@ -1119,6 +1658,9 @@ namespace neat_dnfs
         " Average genome size: {}\n"
         " Average connection genes: {}\n"
         " Average field genes: {}\n"
+        " Fitness cache hits/misses: {}/{}\n"
+        " Truncated evaluations: {}\n"
+        " Saved simulation steps: {}\n"
         " Best solution: [{}]",
         parameters.currentGeneration,
         solutions.size(),
@@ -1132,6 +1674,10 @@ namespace neat_dnfs
         perGenStatistics.averageGenomeSize,
         perGenStatistics.averageConnectionGenes,
         perGenStatistics.averageFieldGenes,
+        perGenStatistics.fitnessCacheHits,
+        perGenStatistics.fitnessCacheMisses,
+        perGenStatistics.truncatedEvaluations,
+        perGenStatistics.savedSimulationSteps,
         bestSolution->toString()
     ));
 }
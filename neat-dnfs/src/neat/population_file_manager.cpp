@@ -4,23 +4,41 @@
 #include <chrono>
 #include <ctime>
 #include <filesystem>
+#include <format>
 #include <fstream>
 #include <iomanip>
+#include <limits>
+#include <sstream>
 
 #include "neat/population.h"
+#include "neat_tools/binary_io.h"
 #include "neat_tools/logger.h"
+#include "neat_tools/profiler.h"
 
 namespace neat_dnfs
 {
 	PopulationFileManager::PopulationFileManager(const Population& population)
 		: population(&population)
-	{}
+	{
+		if (PopulationConstants::asyncFileWrites)
+		{
+			writer = std::make_unique<tools::AsyncWriter>();
+		}
+	}
 
 	void PopulationFileManager::saveOverviewForGeneration() const
 	{
 		if (PopulationConstants::saveOverview)
 		{
-			savePerGenerationOverview();
+			if (PopulationConstants::saveOverviewText)
+			{
+				savePerGenerationOverview();
+			}
+			if (PopulationConstants::saveTelemetry)
+			{
+				saveGenerationTelemetry();
+				saveSpeciesTelemetry();
+			}
 		}
 	}
 
@@ -62,6 +80,15 @@ namespace neat_dnfs
 		{
 			saveChampions();
 		}
+		flushTelemetry();
+	}
+
+	void PopulationFileManager::flush() const
+	{
+		if (writer)
+		{
+			writer->flush();
+		}
 	}
 
 	void PopulationFileManager::setFileDirectory()
@@ -85,12 +112,92 @@ namespace neat_dnfs
 
 		fileDirectory = std::string(PROJECT_DIR) + "/data/" + solutionName + "/" + timeBuffer.data() + "/";
 		std::filesystem::create_directories(fileDirectory); // Ensure directory exist
+		openTelemetry();
 	}
 
-	void PopulationFileManager::saveAllSolutionsWithFitnessAbove(const double fitness) const
+	void PopulationFileManager::setFileDirectory(const std::string& directory)
 	{
-		using namespace dnf_composer;
+		if (!std::filesystem::is_directory(directory))
+		{
+			throw std::runtime_error("Run directory " + directory + " does not exist.");
+		}
+		fileDirectory = directory;
+		if (!fileDirectory.ends_with('/'))
+		{
+			fileDirectory += '/';
+		}
+		openTelemetry();
+	}
 
+	void PopulationFileManager::saveCheckpoint() const
+	{
+		// Resuming from the checkpoint appends to the telemetry files, so
+		// they should hold at least every generation it has seen.
+		flushTelemetry();
+
+		std::ostringstream checkpoint(std::ios::binary);
+		population->writeCheckpoint(checkpoint);
+		write([filePath = fileDirectory + PopulationConstants::checkpointFileName, contents = std::move(checkpoint).str()]()
+			{
+				try
+				{
+					tools::writeFileAtomically(filePath, contents);
+				}
+				catch (const std::exception& error)
+				{
+					tools::logger::log(tools::logger::LogLevel::ERROR, std::string("Failed to save checkpoint: ") + error.what());
+				}
+			});
+	}
+
+	void PopulationFileManager::savePhaseProfile() const
+	{
+		const auto milliseconds = [](const double nanoseconds) { return std::format("{:.3f}", nanoseconds / 1e6); };
+
+		std::ostringstream logFile;
+		for (size_t phase = 0; phase < population->phaseProfile.size(); ++phase)
+		{
+			const tools::PhaseHistogram& histogram = population->phaseProfile[phase];
+			if (histogram.count == 0)
+			{
+				continue;
+			}
+			logFile << "Generation: " << population->parameters.currentGeneration;
+			logFile << " Phase: " << tools::phaseName(static_cast<tools::Phase>(phase));
+			logFile << " Count: " << histogram.count;
+			logFile << " Total (ms): " << milliseconds(static_cast<double>(histogram.totalNanoseconds));
+			logFile << " Mean (ms): " << milliseconds(histogram.meanNanoseconds());
+			logFile << " Min (ms): " << milliseconds(static_cast<double>(histogram.minNanoseconds));
+			logFile << " p50 (ms): " << milliseconds(static_cast<double>(histogram.quantileNanoseconds(0.5)));
+			logFile << " p95 (ms): " << milliseconds(static_cast<double>(histogram.quantileNanoseconds(0.95)));
+			logFile << " Max (ms): " << milliseconds(static_cast<double>(histogram.maxNanoseconds));
+			logFile << "\n";
+
+			appendTelemetry(phaseTelemetry, { population->parameters.currentGeneration, phase, histogram.count,
+				histogram.totalNanoseconds, histogram.minNanoseconds, histogram.quantileNanoseconds(0.5),
+				histogram.quantileNanoseconds(0.95), histogram.maxNanoseconds });
+		}
+		appendToFile(fileDirectory + "phase_times.txt", logFile.str(), "Failed to open log file for phase times.");
+	}
+
+	void PopulationFileManager::savePhaseTrace() const
+	{
+		std::ostringstream trace;
+		tools::Profiler::instance().writeChromeTrace(trace);
+		write([filePath = fileDirectory + "phase_trace.json", contents = std::move(trace).str()]()
+			{
+				std::ofstream file(filePath, std::ios::trunc);
+				if (!file.is_open())
+				{
+					tools::logger::log(tools::logger::LogLevel::ERROR, "Failed to open file for the phase trace.");
+					return;
+				}
+				file << contents;
+			});
+	}
+
+	void PopulationFileManager::saveAllSolutionsWithFitnessAbove(const double fitness) const
+	{
 		const std::string directoryPath = fileDirectory + "best_solutions/last_generation/";
 		std::filesystem::create_directories(directoryPath); // Ensure directory exist
 
@@ -98,27 +205,7 @@ namespace neat_dnfs
 		{
 			if (solution->getFitness() > fitness)
 			{
-				solution->buildPhenotype();
-				solution->createPhenotypeEnvironment();
-				auto simulation = solution->getPhenotype();
-				solution->clearPhenotype();
-				// save weights
-				for (const auto& element : simulation.getElements())
-				{
-					if (element->getLabel() == element::ElementLabel::FIELD_COUPLING)
-					{
-						const auto fieldCoupling = std::dynamic_pointer_cast<element::FieldCoupling>(element);
-						fieldCoupling->writeWeights();
-					}
-				}
-				// save elements
-				const std::string uniqueIdentifier = "solution " + std::to_string(solution->getId())
-					+ " generation " + std::to_string(population->parameters.currentGeneration)
-					+ " species " + std::to_string(solution->getSpeciesId())
-					+ " fitness " + std::to_string(solution->getFitness());
-				simulation.setUniqueIdentifier(uniqueIdentifier);
-				SimulationFileManager sfm(std::make_shared<Simulation>(simulation), directoryPath);
-				sfm.saveElementsToJson();
+				savePhenotype(solution, directoryPath, true);
 			}
 		}
 	}
@@ -141,27 +228,7 @@ namespace neat_dnfs
 			{
 				continue;
 			}
-			champion->buildPhenotype();
-			champion->createPhenotypeEnvironment();
-			auto simulation = champion->getPhenotype();
-			champion->clearPhenotype();
-			// save weights
-			for (const auto& element : simulation.getElements())
-			{
-				if (element->getLabel() == element::ElementLabel::FIELD_COUPLING)
-								{
-					const auto fieldCoupling = std::dynamic_pointer_cast<element::FieldCoupling>(element);
-					fieldCoupling->writeWeights();
-				}
-			}
-			// save elements
-			const std::string uniqueIdentifier = "solution " + std::to_string(champion->getId())
-				+ " generation " + std::to_string(population->parameters.currentGeneration)
-				+ " species " + std::to_string(champion->getSpeciesId())
-				+ " fitness " + std::to_string(champion->getFitness());
-			simulation.setUniqueIdentifier(uniqueIdentifier);
-			SimulationFileManager sfm(std::make_shared<Simulation>(simulation), directoryPath);
-			sfm.saveElementsToJson();
+			savePhenotype(champion, directoryPath, true);
 		}
 	}
 
@@ -170,70 +237,50 @@ namespace neat_dnfs
 		const std::string directoryPath = fileDirectory + "/";
 		std::filesystem::create_directories(directoryPath); // Ensure directory exists
 
-		std::ofstream logFile(directoryPath + "evolution_timestamps.txt", std::ios::app);
-		if (logFile.is_open())
-		{
-			// Convert steady_clock timestamps to system_clock timestamps
-			const auto system_start = std::chrono::system_clock::now() +
-				std::chrono::duration_cast<std::chrono::system_clock::duration>(
-					population->statistics.start - std::chrono::steady_clock::now());
+		// Convert steady_clock timestamps to system_clock timestamps
+		const auto system_start = std::chrono::system_clock::now() +
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(
+				population->statistics.start - std::chrono::steady_clock::now());
 
-			const auto system_end = std::chrono::system_clock::now() +
-				std::chrono::duration_cast<std::chrono::system_clock::duration>(
-					population->statistics.end - std::chrono::steady_clock::now());
+		const auto system_end = std::chrono::system_clock::now() +
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(
+				population->statistics.end - std::chrono::steady_clock::now());
 
-			// Convert to time_t for formatting
-			const std::time_t start_time_t = std::chrono::system_clock::to_time_t(system_start);
-			const std::time_t end_time_t = std::chrono::system_clock::to_time_t(system_end);
+		// Convert to time_t for formatting
+		const std::time_t start_time_t = std::chrono::system_clock::to_time_t(system_start);
+		const std::time_t end_time_t = std::chrono::system_clock::to_time_t(system_end);
 
-			struct tm startTm{};
-			struct tm endTm{};
+		struct tm startTm{};
+		struct tm endTm{};
 #ifdef _WIN32
-			localtime_s(&startTm, &start_time_t);
-			localtime_s(&endTm, &end_time_t);
+		localtime_s(&startTm, &start_time_t);
+		localtime_s(&endTm, &end_time_t);
 #else
-			localtime_r(&start_time_t, &startTm);
-			localtime_r(&end_time_t, &endTm);
+		localtime_r(&start_time_t, &startTm);
+		localtime_r(&end_time_t, &endTm);
 #endif
 
-			// Log number of generations
-			logFile << "Number of generations: " << population->parameters.currentGeneration << "\n";
-			// Format and write timestamps
-			logFile << "Evolution Start Time: " << std::put_time(&startTm, "%Y-%m-%d %H:%M:%S") << "\n";
-			logFile << "Evolution End Time: " << std::put_time(&endTm, "%Y-%m-%d %H:%M:%S") << "\n";
-			logFile << "Duration (seconds): " << population->statistics.duration << "\n";
-			logFile << "Duration (minutes): " << population->statistics.duration / 60 << "\n";
-			logFile << "Duration (hours): " << population->statistics.duration / 3600 << "\n";
-
-			logFile.close();
-		}
-		else
-		{
-			tools::logger::log(tools::logger::LogLevel::ERROR, "Failed to open log file for timestamps.");
-		}
+		std::ostringstream timestamps;
+		// Log number of generations
+		timestamps << "Number of generations: " << population->parameters.currentGeneration << "\n";
+		// Format and write timestamps
+		timestamps << "Evolution Start Time: " << std::put_time(&startTm, "%Y-%m-%d %H:%M:%S") << "\n";
+		timestamps << "Evolution End Time: " << std::put_time(&endTm, "%Y-%m-%d %H:%M:%S") << "\n";
+		timestamps << "Duration (seconds): " << population->statistics.duration << "\n";
+		timestamps << "Duration (minutes): " << population->statistics.duration / 60 << "\n";
+		timestamps << "Duration (hours): " << population->statistics.duration / 3600 << "\n";
+
+		appendToFile(directoryPath + "evolution_timestamps.txt", timestamps.str(), "Failed to open log file for timestamps.");
 	}
 
 	void PopulationFileManager::saveAllSolutionsPerGeneration() const
 	{
-		using namespace dnf_composer;
-
 		for (const auto& solution : population->solutions)
 		{
 			const std::string directoryPath = fileDirectory + "solutions/gen " + std::to_string(population->parameters.currentGeneration) + "/";
 			std::filesystem::create_directories(directoryPath); // Ensure directory exists
 
-			solution->buildPhenotype();
-			solution->createPhenotypeEnvironment();
-			auto simulation = solution->getPhenotype();
-			solution->clearPhenotype();
-
-			const std::string uniqueIdentifier = "solution " + std::to_string(solution->getId())
-				+ " generation " + std::to_string(population->parameters.currentGeneration)
-				+ " species " + std::to_string(solution->getSpeciesId())
-				+ " fitness " + std::to_string(solution->getFitness());
-			simulation.setUniqueIdentifier(uniqueIdentifier);
-			SimulationFileManager sfm(std::make_shared<Simulation>(simulation), directoryPath);
-			sfm.saveElementsToJson();
+			savePhenotype(solution, directoryPath, false);
 		}
 	}
 
@@ -242,66 +289,166 @@ namespace neat_dnfs
 		const std::string directoryPath = fileDirectory + "/";
 		std::filesystem::create_directories(directoryPath); // Ensure directory exists
 
-		std::ofstream logFile(directoryPath + "per_generation_overview.txt", std::ios::app);
-		if (logFile.is_open())
+		std::ostringstream logFile;
+		logFile << "Current generation: " + std::to_string(population->parameters.currentGeneration);
+		logFile << " Number of solutions: " + std::to_string(population->solutions.size());
+		logFile << " Number of species: " + std::to_string(population->perGenStatistics.numberOfSpecies);
+		logFile << " Number of active species: " + std::to_string(population->perGenStatistics.numberOfActiveSpecies);
+		logFile << " Has fitness improved: " << (population->hasFitnessImproved ? "yes" : "no");
+		logFile << " Number of generations without improvement: " + std::to_string(population->generationsWithoutImprovement);
+		logFile << " Average fitness: " + std::to_string(population->perGenStatistics.averageFitness);
+		logFile << " Best fitness: " + std::to_string(population->perGenStatistics.bestFitness);
+		logFile << " Innovation number: " + std::to_string(population->perGenStatistics.innovationNumber);
+		logFile << " Average genome size: " + std::to_string(population->perGenStatistics.averageGenomeSize);
+		logFile << " Average connection genes: " + std::to_string(population->perGenStatistics.averageConnectionGenes);
+		logFile << " Average field genes: " + std::to_string(population->perGenStatistics.averageFieldGenes);
+		logFile << " Fitness cache hits: " + std::to_string(population->perGenStatistics.fitnessCacheHits);
+		logFile << " Fitness cache misses: " + std::to_string(population->perGenStatistics.fitnessCacheMisses);
+		logFile << " Truncated evaluations: " + std::to_string(population->perGenStatistics.truncatedEvaluations);
+		logFile << " Saved simulation steps: " + std::to_string(population->perGenStatistics.savedSimulationSteps);
+		logFile << " Best solution: [" + population->bestSolution->toString() + "]";
+		logFile << "\n";
+
+		appendToFile(directoryPath + "per_generation_overview.txt", logFile.str(),
+			"Failed to open log file for field gene per generation statistics.");
+	}
+
+	void PopulationFileManager::saveGenerationTelemetry() const
+	{
+		const auto& statistics = population->perGenStatistics;
+		const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - population->statistics.start).count();
+		appendTelemetry(generationTelemetry, {
+			population->parameters.currentGeneration,
+			population->solutions.size(),
+			statistics.numberOfSpecies,
+			statistics.numberOfActiveSpecies,
+			population->hasFitnessImproved,
+			population->generationsWithoutImprovement,
+			statistics.averageFitness,
+			statistics.bestFitness,
+			statistics.innovationNumber,
+			statistics.averageGenomeSize,
+			statistics.averageConnectionGenes,
+			statistics.averageFieldGenes,
+			statistics.fitnessCacheHits,
+			statistics.fitnessCacheMisses,
+			statistics.truncatedEvaluations,
+			statistics.earlyTerminationThreshold,
+			statistics.savedSimulationSteps,
+			population->bestSolution->getId(),
+			population->bestSolution->getSpeciesId(),
+			population->validationReport.total(),
+			elapsed });
+	}
+
+	void PopulationFileManager::saveSpeciesTelemetry() const
+	{
+		for (const auto& species : population->speciesList)
 		{
-			logFile << "Current generation: " + std::to_string(population->parameters.currentGeneration);
-			logFile << " Number of solutions: " + std::to_string(population->solutions.size());
-			logFile << " Number of species: " + std::to_string(population->perGenStatistics.numberOfSpecies);
-			logFile << " Number of active species: " + std::to_string(population->perGenStatistics.numberOfActiveSpecies);
-			logFile << " Has fitness improved: " << (population->hasFitnessImproved ? "yes" : "no");
-			logFile << " Number of generations without improvement: " + std::to_string(population->generationsWithoutImprovement);
-			logFile << " Average fitness: " + std::to_string(population->perGenStatistics.averageFitness);
-			logFile << " Best fitness: " + std::to_string(population->perGenStatistics.bestFitness);
-			logFile << " Innovation number: " + std::to_string(population->perGenStatistics.innovationNumber);
-			logFile << " Average genome size: " + std::to_string(population->perGenStatistics.averageGenomeSize);
-			logFile << " Average connection genes: " + std::to_string(population->perGenStatistics.averageConnectionGenes);
-			logFile << " Average field genes: " + std::to_string(population->perGenStatistics.averageFieldGenes);
-			logFile << " Best solution: [" + population->bestSolution->toString() + "]";
-			logFile << "\n";
-			logFile.close();
+			const auto champion = species->getChampion();
+			appendTelemetry(speciesTelemetry, {
+				population->parameters.currentGeneration,
+				species->getId(),
+				species->size(),
+				species->getOffspringCount(),
+				species->isExtinct(),
+				species->getAge(),
+				species->hasFitnessImprovedOverTheLastGenerations(),
+				champion ? champion->getFitness() : std::numeric_limits<double>::quiet_NaN(),
+				species->totalAdjustedFitness() });
 		}
-		else
+	}
+
+	void PopulationFileManager::openTelemetry()
+	{
+		if (!PopulationConstants::saveTelemetry)
 		{
-			tools::logger::log(tools::logger::LogLevel::ERROR,
-				"Failed to open log file for field gene per generation statistics.");
+			return;
+		}
+		using Column = tools::TelemetryColumn;
+		constexpr auto int64 = tools::TelemetryColumnType::Int64;
+		constexpr auto float64 = tools::TelemetryColumnType::Float64;
+		constexpr auto batchRows = static_cast<size_t>(PopulationConstants::telemetryBatchRows);
+
+		// Column order is the order saveGenerationTelemetry(),
+		// saveSpeciesTelemetry() and savePhaseProfile() append values in.
+		generationTelemetry = std::make_shared<tools::TelemetryWriter>(fileDirectory + "telemetry_generations.bin",
+			std::vector<Column>{ { "generation", int64 }, { "numSolutions", int64 }, { "numberOfSpecies", int64 },
+			{ "numberOfActiveSpecies", int64 }, { "hasFitnessImproved", int64 }, { "generationsWithoutImprovement", int64 },
+			{ "averageFitness", float64 }, { "bestFitness", float64 }, { "innovationNumber", int64 },
+			{ "averageGenomeSize", float64 }, { "averageConnectionGenes", float64 }, { "averageFieldGenes", float64 },
+			{ "fitnessCacheHits", int64 }, { "fitnessCacheMisses", int64 }, { "truncatedEvaluations", int64 },
+			{ "earlyTerminationThreshold", float64 }, { "savedSimulationSteps", int64 }, { "bestSolutionId", int64 },
+			{ "bestSolutionSpeciesId", int64 }, { "validationViolations", int64 }, { "elapsedMilliseconds", int64 } },
+			batchRows);
+		speciesTelemetry = std::make_shared<tools::TelemetryWriter>(fileDirectory + "telemetry_species.bin",
+			std::vector<Column>{ { "generation", int64 }, { "speciesId", int64 }, { "size", int64 },
+			{ "offspringCount", int64 }, { "extinct", int64 }, { "age", int64 }, { "hasFitnessImproved", int64 },
+			{ "championFitness", float64 }, { "totalAdjustedFitness", float64 } },
+			batchRows * 8);
+		if constexpr (tools::profilingEnabled)
+		{
+			// phase indexes tools::Phase
+			phaseTelemetry = std::make_shared<tools::TelemetryWriter>(fileDirectory + "telemetry_phases.bin",
+				std::vector<Column>{ { "generation", int64 }, { "phase", int64 }, { "count", int64 },
+				{ "totalNanoseconds", int64 }, { "minNanoseconds", int64 }, { "p50Nanoseconds", int64 },
+				{ "p95Nanoseconds", int64 }, { "maxNanoseconds", int64 } },
+				batchRows * static_cast<size_t>(tools::Phase::Count));
 		}
 	}
 
-	void PopulationFileManager::saveBestSolutionOfEachGeneration() const
+	void PopulationFileManager::flushTelemetry() const
 	{
-		using namespace dnf_composer;
-
-		const std::string directoryPath = fileDirectory + "best_solutions/prev_generations/";
-		std::filesystem::create_directories(directoryPath); // Ensure directory exist
-
-		population->bestSolution->buildPhenotype();
-		population->bestSolution->createPhenotypeEnvironment();
-		auto simulation = population->bestSolution->getPhenotype();
-		population->bestSolution->clearPhenotype();
-		// save weights
-		for (const auto& element : simulation.getElements())
+		for (const auto& telemetry : { generationTelemetry, speciesTelemetry, phaseTelemetry })
 		{
-			if (element->getLabel() == element::ElementLabel::FIELD_COUPLING)
+			if (!telemetry)
 			{
-				const auto fieldCoupling = std::dynamic_pointer_cast<element::FieldCoupling>(element);
-				fieldCoupling->writeWeights();
+				continue;
 			}
+			write([telemetry]()
+				{
+					try
+					{
+						telemetry->flush();
+					}
+					catch (const std::exception& error)
+					{
+						tools::logger::log(tools::logger::LogLevel::ERROR, std::string("Failed to write telemetry: ") + error.what());
+					}
+				});
 		}
-		// save elements
-		const std::string uniqueIdentifier = "solution " + std::to_string(population->bestSolution->getId())
-			+ " generation " + std::to_string(population->parameters.currentGeneration)
-			+ " species " + std::to_string(population->bestSolution->getSpeciesId())
-			+ " fitness " + std::to_string(population->bestSolution->getFitness());
-		simulation.setUniqueIdentifier(uniqueIdentifier);
-		SimulationFileManager sfm(std::make_shared<Simulation>(simulation), directoryPath);
-		sfm.saveElementsToJson();
 	}
 
-	void PopulationFileManager::saveChampionsOfEachGeneration() const
+	void PopulationFileManager::appendTelemetry(const std::shared_ptr<tools::TelemetryWriter>& telemetry, std::vector<tools::TelemetryValue> row) const
 	{
-		using namespace dnf_composer;
+		if (!telemetry)
+		{
+			return;
+		}
+		write([telemetry, row = std::move(row)]()
+			{
+				try
+				{
+					telemetry->append(row);
+				}
+				catch (const std::exception& error)
+				{
+					tools::logger::log(tools::logger::LogLevel::ERROR, std::string("Failed to write telemetry: ") + error.what());
+				}
+			});
+	}
 
+	void PopulationFileManager::saveBestSolutionOfEachGeneration() const
+	{
+		const std::string directoryPath = fileDirectory + "best_solutions/prev_generations/";
+		std::filesystem::create_directories(directoryPath); // Ensure directory exist
+
+		savePhenotype(population->bestSolution, directoryPath, true);
+	}
+
+	void PopulationFileManager::saveChampionsOfEachGeneration() const
+	{
 		const std::string directoryPath = fileDirectory + "champions/prev_generations/";
 		std::filesystem::create_directories(directoryPath); // Ensure directory exist
 
@@ -311,27 +458,7 @@ namespace neat_dnfs
 			{
 				continue;
 			}
-			champion->buildPhenotype();
-			champion->createPhenotypeEnvironment();
-			auto simulation = champion->getPhenotype();
-			champion->clearPhenotype();
-			// save weights
-			for (const auto& element : simulation.getElements())
-			{
-				if (element->getLabel() == element::ElementLabel::FIELD_COUPLING)
-				{
-					const auto fieldCoupling = std::dynamic_pointer_cast<element::FieldCoupling>(element);
-					fieldCoupling->writeWeights();
-				}
-			}
-			// save elements
-			const std::string uniqueIdentifier = "solution " + std::to_string(champion->getId())
-				+ " generation " + std::to_string(population->parameters.currentGeneration)
-				+ " species " + std::to_string(champion->getSpeciesId())
-				+ " fitness " + std::to_string(champion->getFitness());
-			simulation.setUniqueIdentifier(uniqueIdentifier);
-			SimulationFileManager sfm(std::make_shared<Simulation>(simulation), directoryPath);
-			sfm.saveElementsToJson();
+			savePhenotype(champion, directoryPath, true);
 		}
 	}
 
@@ -340,20 +467,13 @@ namespace neat_dnfs
 		const std::string directoryPath = fileDirectory + "statistics/";
 		std::filesystem::create_directories(directoryPath); // Ensure directory exists
 
-		std::ofstream logFile(directoryPath + "generation_" + std::to_string(population->parameters.currentGeneration) + ".txt",
-			std::ios::app);
-		if (logFile.is_open())
-		{
-			for (const auto& solution : population->solutions)
-			{
-				logFile << solution->toString() << '\n';
-			}
-			logFile.close();
-		}
-		else
+		std::ostringstream logFile;
+		for (const auto& solution : population->solutions)
 		{
-			tools::logger::log(tools::logger::LogLevel::ERROR, "Failed to open log file for statistics.");
+			logFile << solution->toString() << '\n';
 		}
+		appendToFile(directoryPath + "generation_" + std::to_string(population->parameters.currentGeneration) + ".txt",
+			logFile.str(), "Failed to open log file for statistics.");
 	}
 
 	void PopulationFileManager::savePerGenerationSpecies() const
@@ -361,19 +481,85 @@ namespace neat_dnfs
 		const std::string directoryPath = fileDirectory + "species/";
 		std::filesystem::create_directories(directoryPath); // Ensure directory exists
 
-		std::ofstream logFile(directoryPath + "generation_" + std::to_string(population->parameters.currentGeneration) + ".txt",
-			std::ios::app);
-		if (logFile.is_open())
+		std::ostringstream logFile;
+		for (const auto& species : population->speciesList)
 		{
-			for (const auto& species : population->speciesList)
+			logFile << species->toString() << '\n';
+		}
+		appendToFile(directoryPath + "generation_" + std::to_string(population->parameters.currentGeneration) + ".txt",
+			logFile.str(), "Failed to open log file for species.");
+	}
+
+	void PopulationFileManager::savePhenotype(const SolutionPtr& solution, const std::string& directoryPath, const bool saveWeights) const
+	{
+		using namespace dnf_composer;
+
+		// Exporting reads the solution, so it stays on this thread; only the
+		// detached simulation travels to the writer. The solution's live
+		// phenotype is left for its next evaluation to patch or reuse.
+		const auto simulation = std::make_shared<Simulation>(solution->exportPhenotype());
+
+		const std::string uniqueIdentifier = "solution " + std::to_string(solution->getId())
+			+ " generation " + std::to_string(population->parameters.currentGeneration)
+			+ " species " + std::to_string(solution->getSpeciesId())
+			+ " fitness " + std::to_string(solution->getFitness());
+		simulation->setUniqueIdentifier(uniqueIdentifier);
+
+		write([simulation, directoryPath, saveWeights]()
 			{
-				logFile << species->toString() << '\n';
-			}
-			logFile.close();
+				// save weights
+				if (saveWeights)
+				{
+					for (const auto& element : simulation->getElements())
+					{
+						if (element->getLabel() == element::ElementLabel::FIELD_COUPLING)
+						{
+							const auto fieldCoupling = std::dynamic_pointer_cast<element::FieldCoupling>(element);
+							fieldCoupling->writeWeights();
+						}
+					}
+				}
+				// save elements
+				SimulationFileManager sfm(simulation, directoryPath);
+				sfm.saveElementsToJson();
+			});
+	}
+
+	void PopulationFileManager::appendToFile(const std::string& filePath, std::string contents, const std::string& errorMessage) const
+	{
+		write([filePath, contents = std::move(contents), errorMessage]()
+			{
+				std::ofstream logFile(filePath, std::ios::app);
+				if (logFile.is_open())
+				{
+					logFile << contents;
+					logFile.close();
+				}
+				else
+				{
+					tools::logger::log(tools::logger::LogLevel::ERROR, errorMessage);
+				}
+			});
+	}
+
+	void PopulationFileManager::write(std::function<void()> job) const
+	{
+		if constexpr (tools::profilingEnabled)
+		{
+			// Timed where it runs, i.e. on the writer thread when there is one.
+			job = [job = std::move(job)]()
+				{
+					NEAT_DNFS_PROFILE_PHASE(tools::Phase::FileIO);
+					job();
+				};
+		}
+		if (writer)
+		{
+			writer->enqueue(std::move(job));
 		}
 		else
 		{
-			tools::logger::log(tools::logger::LogLevel::ERROR, "Failed to open log file for species.");
+			job();
 		}
 	}
 }
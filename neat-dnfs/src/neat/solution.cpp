@@ -6,32 +6,88 @@
 #include <cmath>
 #include <algorithm>
 
+#include "neat_tools/profiler.h"
+
 namespace neat_dnfs
 {
-	Solution::Solution(const SolutionTopology& initialTopology)
-		: id(uniqueIdentifierCounter++),
-		name("undefined"),
-		initialTopology(initialTopology),
-		phenotype(std::format("{}{}", SimulationConstants::name, id), SimulationConstants::deltaT),
-		parents(0,0)
+	namespace
 	{
-		bool hasInput = false;
-		bool hasOutput = false;
-		for (const auto& geneTypeAndDimension : initialTopology.geneTopology)
+		// Steps until @p iterations have run or, with adaptive stepping, until
+		// every field has settled; returns the steps that saved.
+		template <typename Step, typename ForEachActivation>
+		int stepUntilSettled(const int iterations, const size_t numFields, const Step& step, const ForEachActivation& forEachActivation)
 		{
-			if (geneTypeAndDimension.first == FieldGeneType::INPUT)
+			if constexpr (!SimulationConstants::adaptiveStepping)
 			{
-				hasInput = true;
+				for (int i = 0; i < iterations; ++i)
+				{
+					step();
+				}
+				return 0;
 			}
-			if (geneTypeAndDimension.first == FieldGeneType::OUTPUT)
+
+			// NormalNoise feeds amplitude / sqrt(deltaT) standard deviations into
+			// the field input, which moves an activation sample by
+			// amplitude * sqrt(deltaT) / tau per step, so that much jitter is
+			// allowed on top of the configured tolerance.
+			// It is sized for the default tau; faster fields jitter more and just
+			// run their full budget rather than risk settling too early.
+			static const double tolerance = SimulationConstants::steadyStateTolerance
+				+ SimulationConstants::steadyStateNoiseMultiple * NoiseConstants::amplitude
+				* std::sqrt(SimulationConstants::deltaT) / NeuralFieldConstants::tau;
+
+			std::vector<std::vector<double>> previous(numFields);
+			forEachActivation([&previous](const size_t f, const std::span<const double> activation)
 			{
-				hasOutput = true;
+				previous[f].assign(activation.begin(), activation.end());
+			});
+			// Comparing against the start of the window as well as the previous
+			// step keeps a slow drift (a decaying bump) from passing as settled.
+			std::vector<std::vector<double>> windowStart = previous;
+			int settledSteps = 0;
+
+			for (int i = 0; i < iterations; ++i)
+			{
+				step();
+
+				bool settled = true;
+				forEachActivation([&](const size_t f, const std::span<const double> activation)
+				{
+					for (size_t x = 0; x < activation.size(); ++x)
+					{
+						if (std::abs(activation[x] - previous[f][x]) > tolerance ||
+							std::abs(activation[x] - windowStart[f][x]) > tolerance)
+						{
+							settled = false;
+						}
+						previous[f][x] = activation[x];
+					}
+				});
+
+				if (!settled)
+				{
+					settledSteps = 0;
+					windowStart = previous;
+					continue;
+				}
+
+				if (++settledSteps >= SimulationConstants::steadyStateSteps)
+				{
+					return iterations - i - 1;
+				}
 			}
+			return 0;
 		}
-		if (!hasInput || !hasOutput)
-		{
-			throw std::invalid_argument("Number of input and output genes must be greater than 0");
-		}
+	}
+
+	Solution::Solution(const SolutionTopology& initialTopology)
+		: id(uniqueIdentifierCounter++),
+		name("undefined"),
+		initialTopology(initialTopology),
+		phenotype(std::format("{}{}", SimulationConstants::name, id), SimulationConstants::deltaT),
+		parents(0,0)
+	{
+		validateTopology(initialTopology);
 	}
 
 	Solution::Solution(SolutionTopology initialTopology, dnf_composer::Simulation  phenotype)
@@ -48,9 +104,12 @@ namespace neat_dnfs
 
 	void Solution::evaluate()
 	{
-		buildPhenotype();
+		preparePhenotypeForEvaluation();
+		parameters.evaluationTruncated = false;
+		parameters.savedSimulationSteps = 0;
 		try
 		{
+			NEAT_DNFS_PROFILE_PHASE(tools::Phase::TestPhenotype);
 			testPhenotype();
 		}
 		catch (...)
@@ -70,7 +129,125 @@ namespace neat_dnfs
 			}
 			throw;
 		}
-		clearPhenotype();
+
+		if constexpr (SolutionConstants::persistentPhenotype)
+		{
+			// Keep the genome-derived elements alive for the next evaluation and
+			// only drop what testPhenotype() added on top of them. The next
+			// testPhenotype() rewinds field state to the resting level through
+			// initSimulation(), which is far cheaper than rebuilding.
+			NEAT_DNFS_PROFILE_PHASE(tools::Phase::ClearPhenotype);
+			stopSimulation();
+			removeGaussianStimuli();
+		}
+		else
+		{
+			clearPhenotype();
+		}
+	}
+
+	void Solution::preparePhenotypeForEvaluation()
+	{
+		// Switching between drawn and taped noise swaps the noise elements'
+		// type, which patching can't do.
+		if (!SolutionConstants::persistentPhenotype || !phenotypeBuilt
+			|| phenotypeReadsNoiseTape != (noiseTape != nullptr))
+		{
+			buildPhenotype();
+			return;
+		}
+
+		rewindNoiseTape();
+		if (phenotypeInSyncWithGenome)
+		{
+			return;
+		}
+
+		if (computePhenotypeLayout() != phenotypeLayout || !patchPhenotype())
+		{
+			buildPhenotype();
+			return;
+		}
+
+		phenotypeInSyncWithGenome = true;
+	}
+
+	void Solution::rewindNoiseTape()
+	{
+		if (!noiseTape)
+		{
+			return;
+		}
+		for (const auto& element : phenotype.getElements())
+		{
+			if (const auto tapeNoise = std::dynamic_pointer_cast<TapeNoise>(element))
+			{
+				tapeNoise->setTape(noiseTape);
+			}
+		}
+	}
+
+	bool Solution::patchPhenotype()
+	{
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::BuildPhenotype);
+		for (const auto& gene : genome.getFieldGenes())
+		{
+			if (gene.getMutationsInLastGeneration().empty())
+			{
+				continue;
+			}
+
+			const auto neuralField = getNeuralFieldOrThrow(gene.getNeuralFieldName(), "patchPhenotype");
+			neuralField->setParameters(gene.getNeuralFieldParameters());
+
+			if (!applyKernelParameters(std::dynamic_pointer_cast<dnf_composer::element::Kernel>(phenotype.getElement(gene.getKernelName())),
+				gene.getKernelParameters()))
+			{
+				return false;
+			}
+		}
+
+		// Genes hold parameters, not elements, so coupling kernels are patched
+		// the same way; kernel type changes rename the element and show up as a
+		// layout change instead.
+		for (const auto& connectionGene : genome.getConnectionGenes())
+		{
+			if (!connectionGene.isEnabled() || connectionGene.getMutationsInLastGeneration().empty())
+			{
+				continue;
+			}
+
+			if (!applyKernelParameters(std::dynamic_pointer_cast<dnf_composer::element::Kernel>(phenotype.getElement(connectionGene.getKernelName())),
+				connectionGene.getKernelParameters()))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	Solution::PhenotypeLayout Solution::computePhenotypeLayout() const
+	{
+		PhenotypeLayout layout;
+		layout.fieldKernels.reserve(genome.getFieldGenes().size());
+		for (const auto& gene : genome.getFieldGenes())
+		{
+			layout.fieldKernels.emplace_back(gene.getParameters().id, gene.getKernelLabel());
+		}
+
+		for (const auto& connectionGene : genome.getConnectionGenes())
+		{
+			if (connectionGene.isEnabled())
+			{
+				layout.couplings.push_back(connectionGene.getKernelName());
+			}
+		}
+		return layout;
+	}
+
+	void Solution::invalidatePhenotype()
+	{
+		phenotypeInSyncWithGenome = false;
 	}
 
 	void Solution::initialize()
@@ -87,6 +264,7 @@ namespace neat_dnfs
 	void Solution::mutate()
 	{
 		genome.mutate();
+		invalidatePhenotype();
 	}
 
 	void Solution::setSpeciesId(int speciesId)
@@ -138,8 +316,19 @@ namespace neat_dnfs
 
 	void Solution::buildPhenotype()
 	{
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::BuildPhenotype);
+		if (phenotypeBuilt || !phenotype.getElements().empty())
+		{
+			clearPhenotype();
+		}
+
 		translateGenesToPhenotype();
 		translateConnectionGenesToPhenotype();
+		resolveFields();
+		phenotypeLayout = computePhenotypeLayout();
+		phenotypeReadsNoiseTape = noiseTape != nullptr;
+		phenotypeBuilt = true;
+		phenotypeInSyncWithGenome = true;
 	}
 
 	void Solution::createInputGenes()
@@ -196,69 +385,55 @@ namespace neat_dnfs
 
 	void Solution::translateGenesToPhenotype()
 	{
-		using namespace dnf_composer::element;
-
 		for (auto const& gene : genome.getFieldGenes())
 		{
-			const auto nfcp = gene.getNeuralField()->getElementCommonParameters();
-			const auto nfp = gene.getNeuralField()->getParameters();
+			const auto nf = gene.getNeuralField();
 
 			// check if neural field already exists
 			for (const auto& element : phenotype.getElements())
 			{
-				if (element->getUniqueName() == nfcp.identifiers.uniqueName)
+				if (element->getUniqueName() == nf->getUniqueName())
 				{
-					log(tools::logger::LogLevel::ERROR, std::format("Neural field with unique name {} already exists in phenotype.", nfcp.identifiers.uniqueName));	
+					log(tools::logger::LogLevel::ERROR, std::format("Neural field with unique name {} already exists in phenotype.", nf->getUniqueName()));	
 				}
 			}
-
-			const auto nf = std::make_shared<NeuralField>(nfcp, nfp);
 			phenotype.addElement(nf);
 
-			const auto kcp = gene.getKernel()->getElementCommonParameters();
-			switch (kcp.identifiers.label)
-			{
-				case ElementLabel::GAUSS_KERNEL:
-				{
-					const auto gkp = std::dynamic_pointer_cast<GaussKernel>(gene.getKernel())->getParameters();
-					const auto kernel = std::make_shared<GaussKernel>(kcp, gkp);
-					phenotype.addElement(kernel);
-					phenotype.createInteraction(nf->getUniqueName(), "output", kernel->getUniqueName());
-					phenotype.createInteraction(kernel->getUniqueName(), "output", nf->getUniqueName());
-					break;
-				}
-				case ElementLabel::MEXICAN_HAT_KERNEL:
-				{
-					const auto mhkp = std::dynamic_pointer_cast<MexicanHatKernel>(gene.getKernel())->getParameters();
-					const auto kernel = std::make_shared<MexicanHatKernel>(kcp, mhkp);
-					phenotype.addElement(kernel);
-					phenotype.createInteraction(nf->getUniqueName(), "output", kernel->getUniqueName());
-					phenotype.createInteraction(kernel->getUniqueName(), "output", nf->getUniqueName());
-					break;
-				}
-			case ElementLabel::OSCILLATORY_KERNEL:
-				{
-					const auto okp = std::dynamic_pointer_cast<OscillatoryKernel>(gene.getKernel())->getParameters();
-					const auto kernel = std::make_shared<OscillatoryKernel>(kcp, okp);
-					phenotype.addElement(kernel);
-					phenotype.createInteraction(nf->getUniqueName(), "output", kernel->getUniqueName());
-					phenotype.createInteraction(kernel->getUniqueName(), "output", nf->getUniqueName());
-					break;
-				}
-				default:
-					throw std::invalid_argument("Invalid kernel label while translating genes to phenotype.");
-			}
+			const auto kernel = gene.getKernel();
+			phenotype.addElement(kernel);
+			phenotype.createInteraction(nf->getUniqueName(), "output", kernel->getUniqueName());
+			phenotype.createInteraction(kernel->getUniqueName(), "output", nf->getUniqueName());
 
-			const auto nncp = gene.getNoise()->getElementCommonParameters();
-			const auto nnp = gene.getNoise()->getParameters();
-			const auto nn = std::make_shared<NormalNoise>(nncp, nnp);
+			const auto nn = gene.getNoise(noiseTape);
 			phenotype.addElement(nn);
 			phenotype.createInteraction(nn->getUniqueName(), "output", nf->getUniqueName());
 		}
 	}
 
+	dnf_composer::Simulation Solution::exportPhenotype()
+	{
+		// The translation and environment hooks all add to `phenotype`, so the
+		// export is built in its place and the live one swapped back after.
+		dnf_composer::Simulation exported(std::format("{}{}", SimulationConstants::name, id), SimulationConstants::deltaT);
+		std::swap(phenotype, exported);
+		try
+		{
+			translateGenesToPhenotype();
+			translateConnectionGenesToPhenotype();
+			createPhenotypeEnvironment();
+		}
+		catch (...)
+		{
+			std::swap(phenotype, exported);
+			throw;
+		}
+		std::swap(phenotype, exported);
+		return exported;
+	}
+
 	void Solution::clearPhenotype()
 	{
+		NEAT_DNFS_PROFILE_PHASE(tools::Phase::ClearPhenotype);
 		phenotype.close();
 		// remove all interactions
 		for (const auto& element : phenotype.getElements())
@@ -276,6 +451,11 @@ namespace neat_dnfs
 		}
 		// check if elements were removed
 		phenotype.clean();
+		resolvedFields.clear();
+		fieldSnapshots.clear();
+		++phenotypeBuildCount;
+		phenotypeBuilt = false;
+		phenotypeInSyncWithGenome = false;
 		if (!phenotype.getElements().empty())
 		{
 			throw std::runtime_error("Phenotype elements were not cleared correctly.");
@@ -290,7 +470,7 @@ namespace neat_dnfs
 		{
 			if (connectionGene.isEnabled())
 			{
-				auto coupling = connectionGene.getKernel();
+				const auto coupling = connectionGene.getKernel();
 				const auto sourceId = connectionGene.getInFieldGeneId();
 				const auto targetId = connectionGene.getOutFieldGeneId();
 
@@ -305,6 +485,7 @@ namespace neat_dnfs
 	{
 		// Clear the current genome before rebuilding it
 		genome = Genome();
+		invalidatePhenotype();
 
 		if (phenotype.getElements().empty())
 		{
@@ -530,11 +711,114 @@ namespace neat_dnfs
 
 	void Solution::clearGenome()
 	{
-		genome = Genome();
+		// A genome rebuilt from scratch can reuse the old element names with
+		// different parameters and no mutation record to patch from.
+		if (phenotypeBuilt)
+		{
+			clearPhenotype();
+		}
+		genome.clear();
+		invalidatePhenotype();
+	}
+
+	void Solution::reinitialize(const SolutionTopology& topology)
+	{
+		validateTopology(topology);
+		if (phenotypeBuilt || !phenotype.getElements().empty())
+		{
+			clearPhenotype();
+		}
+
+		id = uniqueIdentifierCounter++;
+		initialTopology = topology;
+		parameters = SolutionParameters();
+		phenotype = dnf_composer::Simulation(std::format("{}{}", SimulationConstants::name, id), SimulationConstants::deltaT);
+		genome.clear();
+		parents = std::make_tuple(0, 0);
+		phenotypeLayout.fieldKernels.clear();
+		phenotypeLayout.couplings.clear();
+		phenotypeBuilt = false;
+		phenotypeInSyncWithGenome = false;
+		partialFitnessWeights.clear();
+		earlyTerminationThreshold = -std::numeric_limits<double>::infinity();
+		noiseTape = nullptr;
+	}
+
+	void Solution::serialize(tools::BinaryWriter& writer) const
+	{
+		writer.write(static_cast<std::int32_t>(id));
+		writer.write(parameters.fitness);
+		writer.write(parameters.adjustedFitness);
+		writer.write(static_cast<std::int32_t>(parameters.age));
+		writer.write(static_cast<std::int32_t>(parameters.speciesId));
+		writer.write(parameters.evaluationTruncated);
+		writer.write(static_cast<std::int32_t>(parameters.savedSimulationSteps));
+		writer.writeVector(parameters.partialFitness);
+		writer.write(static_cast<std::int32_t>(std::get<0>(parents)));
+		writer.write(static_cast<std::int32_t>(std::get<1>(parents)));
+		genome.serialize(writer);
+	}
+
+	void Solution::deserialize(tools::BinaryReader& reader)
+	{
+		if (phenotypeBuilt || !phenotype.getElements().empty())
+		{
+			clearPhenotype();
+		}
+
+		id = reader.read<std::int32_t>();
+		parameters = SolutionParameters();
+		parameters.fitness = reader.read<double>();
+		parameters.adjustedFitness = reader.read<double>();
+		parameters.age = reader.read<std::int32_t>();
+		parameters.speciesId = reader.read<std::int32_t>();
+		parameters.evaluationTruncated = reader.read<bool>();
+		parameters.savedSimulationSteps = reader.read<std::int32_t>();
+		parameters.partialFitness = reader.readVector<double>();
+		const int parent1 = reader.read<std::int32_t>();
+		const int parent2 = reader.read<std::int32_t>();
+		parents = std::make_tuple(parent1, parent2);
+		genome.deserialize(reader);
+
+		phenotype = dnf_composer::Simulation(std::format("{}{}", SimulationConstants::name, id), SimulationConstants::deltaT);
+		phenotypeLayout.fieldKernels.clear();
+		phenotypeLayout.couplings.clear();
+		phenotypeBuilt = false;
+		phenotypeInSyncWithGenome = false;
+		partialFitnessWeights.clear();
+		earlyTerminationThreshold = -std::numeric_limits<double>::infinity();
+		noiseTape = nullptr;
+	}
+
+	void Solution::validateTopology(const SolutionTopology& topology)
+	{
+		bool hasInput = false;
+		bool hasOutput = false;
+		for (const auto& geneTypeAndDimension : topology.geneTopology)
+		{
+			if (geneTypeAndDimension.first == FieldGeneType::INPUT)
+			{
+				hasInput = true;
+			}
+			if (geneTypeAndDimension.first == FieldGeneType::OUTPUT)
+			{
+				hasOutput = true;
+			}
+		}
+		if (!hasInput || !hasOutput)
+		{
+			throw std::invalid_argument("Number of input and output genes must be greater than 0");
+		}
 	}
 
 	void Solution::clearLastMutations()
 	{
+		// The per-gene mutation record is what patchPhenotype() works from; once
+		// it's gone, a phenotype that hasn't caught up can only be rebuilt.
+		if (phenotypeBuilt && !phenotypeInSyncWithGenome)
+		{
+			clearPhenotype();
+		}
 		genome.clearLastMutations();
 	}
 
@@ -558,14 +842,63 @@ namespace neat_dnfs
 		parameters.adjustedFitness = adjustedFitness;
 	}
 
+	void Solution::setEvaluationResult(const double fitness, const std::vector<double>& partialFitness, const bool truncated)
+	{
+		parameters.fitness = fitness;
+		parameters.partialFitness = partialFitness;
+		parameters.evaluationTruncated = truncated;
+	}
+
+	double Solution::getFitnessUpperBound() const
+	{
+		double bound = parameters.fitness;
+		for (size_t i = parameters.partialFitness.size(); i < partialFitnessWeights.size(); ++i)
+		{
+			bound += partialFitnessWeights[i];
+		}
+		return bound;
+	}
+
+	void Solution::declarePartialFitnessWeights(std::vector<double> weights)
+	{
+		partialFitnessWeights = std::move(weights);
+		parameters.fitness = 0.0;
+		parameters.partialFitness.clear();
+		parameters.partialFitness.reserve(partialFitnessWeights.size());
+	}
+
+	void Solution::recordPartialFitness(const double value)
+	{
+		const size_t index = parameters.partialFitness.size();
+		if (index >= partialFitnessWeights.size())
+		{
+			throw std::logic_error(std::format("{} recorded more partial fitness terms than the {} it declared.",
+				name, partialFitnessWeights.size()));
+		}
+		parameters.partialFitness.push_back(value);
+		parameters.fitness += partialFitnessWeights[index] * value;
+	}
+
+	bool Solution::continueEvaluation()
+	{
+		if (getFitnessUpperBound() >= earlyTerminationThreshold)
+		{
+			return true;
+		}
+		parameters.evaluationTruncated = true;
+		return false;
+	}
+
 	void Solution::addFieldGene(const FieldGene& gene)
 	{
 		genome.addFieldGene(gene);
+		invalidatePhenotype();
 	}
 
 	void Solution::addConnectionGene(const ConnectionGene& gene)
 	{
 		genome.addConnectionGene(gene);
+		invalidatePhenotype();
 	}
 
 	bool Solution::containsConnectionGene(const ConnectionGene& gene) const
@@ -729,6 +1062,7 @@ namespace neat_dnfs
 
 	void Solution::initSimulation()
 	{
+		++phenotypeStep;
 		phenotype.init();
 	}
 
@@ -739,10 +1073,63 @@ namespace neat_dnfs
 
 	void Solution::runSimulation(const int iterations)
 	{
-		for (int i = 0; i < iterations; ++i)
+		const size_t numFields = resolvedFields.size();
+		const auto forEachActivation = [&](const auto& visit)
 		{
-			phenotype.step();
+			for (size_t f = 0; f < numFields; ++f)
+			{
+				const auto& activation = resolvedFields[f]->getComponent("activation");
+				visit(f, std::span<const double>(activation));
+			}
+		};
+		parameters.savedSimulationSteps += stepUntilSettled(iterations, numFields,
+			[this]() { stepPhenotype(); }, forEachActivation);
+	}
+
+	std::vector<double> Solution::runTrials(const std::vector<Trial>& trials)
+	{
+		std::vector<double> partialFitness;
+		for (const Trial& trial : trials)
+		{
+			const auto terms = runTrial(trial);
+			partialFitness.insert(partialFitness.end(), terms.begin(), terms.end());
 		}
+		return partialFitness;
+	}
+
+	std::vector<double> Solution::runTrial(const Trial& trial)
+	{
+		std::vector<double> terms;
+		removeGaussianStimuli();
+		rewindNoiseTape();
+		initSimulation();
+		for (const TrialPhase& phase : trial)
+		{
+			removeGaussianStimuli();
+			for (const TrialStimulus& stimulus : phase.stimuli)
+			{
+				addGaussianStimulus(stimulus.field, stimulus.parameters,
+					resolvedField(stimulus.field)->getElementCommonParameters().dimensionParameters);
+			}
+			runSimulation(phase.iterations);
+
+			TrialSnapshots snapshots;
+			snapshots.snapshots.reserve(resolvedFields.size());
+			for (size_t f = 0; f < resolvedFields.size(); ++f)
+			{
+				snapshots.snapshots.push_back(getFieldSnapshot({ f, phenotypeBuildCount }));
+			}
+			const auto phaseTerms = phase.score(snapshots);
+			terms.insert(terms.end(), phaseTerms.begin(), phaseTerms.end());
+		}
+		removeGaussianStimuli();
+		return terms;
+	}
+
+	void Solution::stepPhenotype()
+	{
+		++phenotypeStep;
+		phenotype.step();
 	}
 
 	void Solution::addGaussianStimulus(const std::string& targetElement, const dnf_composer::element::GaussStimulusParameters& stimulusParameters, 
@@ -757,6 +1144,12 @@ namespace neat_dnfs
 		gaussStimulus->init();
 	}
 
+	void Solution::addGaussianStimulus(const FieldHandle target, const dnf_composer::element::GaussStimulusParameters& stimulusParameters,
+		const dnf_composer::element::ElementDimensions& dimensions)
+	{
+		addGaussianStimulus(resolvedField(target)->getUniqueName(), stimulusParameters, dimensions);
+	}
+
 	void Solution::removeGaussianStimuli()
 	{
 		using namespace dnf_composer::element;
@@ -807,12 +1200,64 @@ namespace neat_dnfs
 		return neuralField;
 	}
 
-	int Solution::clampedIndexForPosition(const std::shared_ptr<dnf_composer::element::NeuralField>& neuralField, const double position)
+	void Solution::resolveFields()
 	{
-		const double d_x = neuralField->getElementCommonParameters().dimensionParameters.d_x;
-		const int rawIndex = static_cast<int>(position / d_x);
-		const int lastValidIndex = neuralField->getSize() - 1;
-		return std::clamp(rawIndex, 0, lastValidIndex);
+		resolvedFields.clear();
+		resolvedFields.reserve(genome.getFieldGenes().size());
+		for (const auto& gene : genome.getFieldGenes())
+		{
+			resolvedFields.push_back(getNeuralFieldOrThrow(gene.getNeuralFieldName(), "buildPhenotype"));
+		}
+		fieldSnapshots.assign(resolvedFields.size(), {});
+		++phenotypeBuildCount;
+	}
+
+	FieldHandle Solution::fieldHandle(const std::string& fieldName, const std::string& callerName) const
+	{
+		const auto it = std::ranges::find_if(resolvedFields, [&fieldName](const NeuralFieldPtr& neuralField)
+			{
+				return neuralField->getUniqueName() == fieldName;
+			});
+		if (it == resolvedFields.end())
+		{
+			throw std::invalid_argument(std::format(
+				"{}: field '{}' does not exist in the phenotype or is not a NeuralField.", callerName, fieldName));
+		}
+		return { static_cast<size_t>(it - resolvedFields.begin()), phenotypeBuildCount };
+	}
+
+	const NeuralFieldPtr& Solution::resolvedField(const FieldHandle field) const
+	{
+		if (field.build != phenotypeBuildCount || field.index >= resolvedFields.size())
+		{
+			throw std::logic_error("FieldHandle used after the phenotype it was resolved on was cleared or rebuilt.");
+		}
+		return resolvedFields[field.index];
+	}
+
+	bool Solution::fieldHasBumps(const FieldHandle field) const
+	{
+		// Checked after every step of iterationsUntilBump()/NoBump(), so it
+		// skips the statistics a full snapshot would gather.
+		return !resolvedField(field)->getBumps().empty();
+	}
+
+	const FieldSnapshot& Solution::getFieldSnapshot(const FieldHandle field) const
+	{
+		const auto& neuralField = resolvedField(field);
+		CachedFieldSnapshot& cached = fieldSnapshots[field.index];
+		if (cached.step == phenotypeStep)
+		{
+			return cached.snapshot;
+		}
+
+		cached.snapshot.take(neuralField->getComponent("activation"),
+			neuralField->getElementCommonParameters().dimensionParameters.d_x,
+			neuralField->getParameters().startingRestingLevel);
+		// Score the bumps the exported phenotype reports in the GUI and sol-eval.
+		cached.snapshot.bumps = neuralField->getBumps();
+		cached.step = phenotypeStep;
+		return cached.snapshot;
 	}
 
 	std::optional<dnf_composer::element::NeuralFieldBump> Solution::matchClosestBump(
@@ -834,25 +1279,21 @@ namespace neat_dnfs
 		return closest;
 	}
 
-	double Solution::closenessToRestingLevel(const std::string& fieldName) const
+	double Solution::closenessToRestingLevel(const FieldSnapshot& snapshot)
 	{
 		// the highest value of activation should be equal to the resting level
 		// the farther it is from the resting level, the lower the fitness (0.0)
 		// the closer it is to the resting level, the higher the fitness (1.0)
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "closenessToRestingLevel");
-
-		const double highestActivationValue = neuralField->getHighestActivation();
-		const double restingLevel = neuralField->getParameters().startingRestingLevel;
+		const double highestActivationValue = snapshot.highestActivation;
+		const double restingLevel = snapshot.restingLevel;
 		const double result = 1.0 / (1.0 + std::abs(highestActivationValue - restingLevel));
 
 		return result;
 	}
 
-	double Solution::noBumps(const std::string& fieldName) const
+	double Solution::noBumps(const FieldSnapshot& snapshot)
 	{
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "noBumps");
-
-		const double highestActivation = neuralField->getHighestActivation();
+		const double highestActivation = snapshot.highestActivation;
 
 		// If activation is below 0, return maximum fitness of 1.0
 		if (highestActivation < 0.0)
@@ -868,15 +1309,14 @@ namespace neat_dnfs
 		return result;
 	}
 
-	double Solution::iterationsUntilBump(const std::string& fieldName, const double targetIterations, const double maxIterations, const double tolerance)
+	double Solution::iterationsUntilBump(const FieldHandle field, const double targetIterations, const double maxIterations, const double tolerance)
 	{
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "iterationsUntilBump");
 		int it = 0;
 		do
 		{
-			phenotype.step();
+			stepPhenotype();
 			it++;
-			if (!neuralField->getBumps().empty())
+			if (fieldHasBumps(field))
 			{
 				const double sigma = 6.0 * tolerance; // smoother shoulders; the higher the constant the smoother
 				return tools::utils::normalizeWithFlatheadGaussian(
@@ -892,16 +1332,14 @@ namespace neat_dnfs
 		return 0.0;
 	}
 
-	double Solution::iterationsUntilNoBump(const std::string& fieldName, const double targetIterations, const double maxIterations, const double tolerance)
+	double Solution::iterationsUntilNoBump(const FieldHandle field, const double targetIterations, const double maxIterations, const double tolerance)
 	{
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "iterationsUntilNoBump");
-
 		int it = 0;
 		do
 		{
-			phenotype.step();
+			stepPhenotype();
 			it++;
-			if (neuralField->getBumps().empty())
+			if (!fieldHasBumps(field))
 			{
 				const double sigma = 6.0 * tolerance; // smoother shoulders; the higher the constant the smoother
 				return tools::utils::normalizeWithFlatheadGaussian(
@@ -917,17 +1355,17 @@ namespace neat_dnfs
 		return 0.0;
 	}
 
-	double Solution::justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(const std::string& fieldName, const std::vector<double>& positions, const double& amplitude, const double& width) const
+	double Solution::justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(const FieldSnapshot& snapshot, const std::vector<double>& positions, const double& amplitude, const double& width)
 	{
 		using namespace dnf_composer::element;
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth");
+		const auto& bumps = snapshot.bumps;
 
 		static constexpr double wBumps  = 0.55;
 		static constexpr double wPos    = 0.35;
 		static constexpr double wAmp    = 0.05;
 		static constexpr double wWidth  = 0.05;
 
-		const int n = static_cast<int>(neuralField->getBumps().size());
+		const int n = static_cast<int>(bumps.size());
 		if (n == 0)
 		{
 			return 0.0;
@@ -937,7 +1375,7 @@ namespace neat_dnfs
 			return 0.2 * (wBumps / (1.0 + std::abs(1 - n)));
 		}
 
-		const NeuralFieldBump bump = neuralField->getBumps().front();
+		const NeuralFieldBump bump = bumps.front();
 
 		// find distance to the closest valid position
 		double minDistance = std::numeric_limits<double>::max();
@@ -965,11 +1403,9 @@ namespace neat_dnfs
 		return fitness;
 	}
 
-	double Solution::oneBumpAtPositionWithAmplitudeAndWidth(const std::string& fieldName, const double& position, const double& 
-		amplitude, const double& width) const
+	double Solution::oneBumpAtPositionWithAmplitudeAndWidth(const FieldSnapshot& snapshot, const double& position, const double& 
+		amplitude, const double& width)
 	{
-		// Field existence and type are validated by getNeuralFieldOrThrow() below,
-		// which throws std::invalid_argument on a missing/wrong-type field name.
 		static constexpr double weightBumps = 0.45;
 		static constexpr double weightPos = 0.45;
 		static constexpr double weightAmp = 0.05;
@@ -984,10 +1420,8 @@ namespace neat_dnfs
 		double fitness = 0.0;
 
 		using namespace dnf_composer::element;
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "oneBumpAtPositionWithAmplitudeAndWidth");
-
-		const auto& bumps = neuralField->getBumps();
-		const int numberOfBumps = static_cast<int>(neuralField->getBumps().size());
+		const auto& bumps = snapshot.bumps;
+		const int numberOfBumps = static_cast<int>(bumps.size());
 		if (numberOfBumps == 0)
 		{
 			return fitness;
@@ -996,7 +1430,7 @@ namespace neat_dnfs
 		fitness += weightBumps / ( 1.0 + std::abs(targetNumberOfBumps - numberOfBumps));
 
 		NeuralFieldBump closestBump = bumps.front();
-		for (const auto& bump : neuralField->getBumps())
+		for (const auto& bump : bumps)
 		{
 			if (std::abs(bump.centroid - position) < std::abs(closestBump.centroid - position))
 			{
@@ -1011,7 +1445,7 @@ namespace neat_dnfs
 		return fitness;
 	}
 
-	double Solution::twoBumpsAtPositionWithAmplitudeAndWidth(const std::string& fieldName, const double& position1, const double& amplitude1, const double& width1, const double& position2, const double& amplitude2, const double& width2) const
+	double Solution::twoBumpsAtPositionWithAmplitudeAndWidth(const FieldSnapshot& snapshot, const double& position1, const double& amplitude1, const double& width1, const double& position2, const double& amplitude2, const double& width2)
 	{
 		static constexpr int targetNumberOfBumps = 2;
 		static constexpr double weightBumps = 0.70;
@@ -1027,9 +1461,9 @@ namespace neat_dnfs
 
 		using namespace dnf_composer::element;
 
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "twoBumpsAtPositionWithAmplitudeAndWidth");
+		std::vector<NeuralFieldBump> candidates = snapshot.bumps;
 
-		const int numberOfBumps = static_cast<int>(neuralField->getBumps().size());
+		const int numberOfBumps = static_cast<int>(candidates.size());
 		if (numberOfBumps == 0)
 		{
 			return fitness;
@@ -1043,7 +1477,6 @@ namespace neat_dnfs
 		// position (see issue #53). If the pool runs out before every slot is
 		// matched, the remaining slot(s) simply contribute no position/amplitude/
 		// width credit, same as the zero-bump case above.
-		std::vector<NeuralFieldBump> candidates = neuralField->getBumps();
 
 		if (const auto bump1 = matchClosestBump(candidates, position1))
 		{
@@ -1062,7 +1495,7 @@ namespace neat_dnfs
 		return fitness;
 	}
 
-	double Solution::threeBumpsAtPositionWithAmplitudeAndWidth(const std::string& fieldName, const double& position1, const double& amplitude1, const double& width1, const double& position2, const double& amplitude2, const double& width2, const double& position3, const double& amplitude3, const double& width3) const
+	double Solution::threeBumpsAtPositionWithAmplitudeAndWidth(const FieldSnapshot& snapshot, const double& position1, const double& amplitude1, const double& width1, const double& position2, const double& amplitude2, const double& width2, const double& position3, const double& amplitude3, const double& width3)
 	{
 		static constexpr int targetNumberOfBumps = 3;
 		static constexpr double weightBumps = 0.40;
@@ -1079,9 +1512,9 @@ namespace neat_dnfs
 
 		using namespace dnf_composer::element;
 
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "threeBumpsAtPositionWithAmplitudeAndWidth");
+		std::vector<NeuralFieldBump> candidates = snapshot.bumps;
 
-		const int numberOfBumps = static_cast<int>(neuralField->getBumps().size());
+		const int numberOfBumps = static_cast<int>(candidates.size());
 		if (numberOfBumps == 0)
 		{
 			return fitness;
@@ -1091,7 +1524,6 @@ namespace neat_dnfs
 
 		// Injective matching -- see the identical comment in
 		// twoBumpsAtPositionWithAmplitudeAndWidth (issue #53).
-		std::vector<NeuralFieldBump> candidates = neuralField->getBumps();
 
 		if (const auto bump1 = matchClosestBump(candidates, position1))
 		{
@@ -1117,13 +1549,10 @@ namespace neat_dnfs
 		return fitness;
 	}
 
-	double Solution::preShapednessAtPosition(const std::string& fieldName, double position) const
+	double Solution::preShapednessAtPosition(const FieldSnapshot& snapshot, double position)
 	{
-		const auto nf = getNeuralFieldOrThrow(fieldName, "preShapednessAtPosition");
-
-		const int idx = clampedIndexForPosition(nf, position);
-		const double u = nf->getComponent("activation")[idx];
-		const double h = nf->getParameters().startingRestingLevel;
+		const double u = snapshot.activationAt(position);
+		const double h = snapshot.restingLevel;
 		const double u_tar =  h / 2.0;
 		constexpr double sigma = 10.0;
 
@@ -1146,22 +1575,19 @@ namespace neat_dnfs
 		return score_height;
 	}
 
-	double Solution::negativePreShapednessAtPosition(const std::string& fieldName, const double& position) const
+	double Solution::negativePreShapednessAtPosition(const FieldSnapshot& snapshot, const double& position)
 	{
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "negativePreShapednessAtPosition");
-
-		const int pos = clampedIndexForPosition(neuralField, position);
-		const double u_pos = neuralField->getComponent("activation")[pos];
+		const double u_pos = snapshot.activationAt(position);
 
 		// activation of field at position should be lower than the resting level
 		// we need to be careful here because if the field is in the resting level, this still produces above 0.5 fitness
 		static constexpr double epsilon = 0.15;
-		if (u_pos >= neuralField->getParameters().startingRestingLevel - epsilon)
+		if (u_pos >= snapshot.restingLevel - epsilon)
 		{
 			return 0.0;
 		}
 
-		const double u_baseline = neuralField->getHighestActivation();
+		const double u_baseline = snapshot.highestActivation;
 		// this should not be like this - I am hardcoding the position of the baseline activation
 		const double u_target = u_baseline + u_baseline / 2.0;
 		constexpr double width = 10.0;// std::abs(u_baseline / 8.0);
@@ -1170,7 +1596,52 @@ namespace neat_dnfs
 		return result;
 	}
 
+	double Solution::closenessToRestingLevel(const FieldHandle field) const
+	{
+		return closenessToRestingLevel(getFieldSnapshot(field));
+	}
+
+	double Solution::noBumps(const FieldHandle field) const
+	{
+		return noBumps(getFieldSnapshot(field));
+	}
+
+	double Solution::oneBumpAtPositionWithAmplitudeAndWidth(const FieldHandle field, const double& position, const double& amplitude, const double& width) const
+	{
+		return oneBumpAtPositionWithAmplitudeAndWidth(getFieldSnapshot(field), position, amplitude, width);
+	}
+
+	double Solution::twoBumpsAtPositionWithAmplitudeAndWidth(const FieldHandle field, const double& position1, const double& amplitude1, const double& width1, const double& position2, const double& amplitude2, const double& width2) const
+	{
+		return twoBumpsAtPositionWithAmplitudeAndWidth(getFieldSnapshot(field),
+			position1, amplitude1, width1, position2, amplitude2, width2);
+	}
 
+	double Solution::threeBumpsAtPositionWithAmplitudeAndWidth(const FieldHandle field, const double& position1, const double& amplitude1, const double& width1, const double& position2, const double& amplitude2, const double& width2, const double& position3, const double& amplitude3, const double& width3) const
+	{
+		return threeBumpsAtPositionWithAmplitudeAndWidth(getFieldSnapshot(field),
+			position1, amplitude1, width1, position2, amplitude2, width2, position3, amplitude3, width3);
+	}
+
+	double Solution::preShapednessAtPosition(const FieldHandle field, const double position) const
+	{
+		return preShapednessAtPosition(getFieldSnapshot(field), position);
+	}
+
+	double Solution::negativePreShapednessAtPosition(const FieldHandle field, const double& position) const
+	{
+		return negativePreShapednessAtPosition(getFieldSnapshot(field), position);
+	}
+
+	double Solution::justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(const FieldHandle field, const std::vector<double>& positions, const double& amplitude, const double& width) const
+	{
+		return justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(getFieldSnapshot(field), positions, amplitude, width);
+	}
+
+	double Solution::negativeBaseline(const FieldHandle field) const
+	{
+		return negativeBaseline(getFieldSnapshot(field));
+	}
 
 	void Solution::moveGaussianStimulusContinuously(const std::string& name, const double targetPosition, const double step)
 	{
@@ -1189,17 +1660,15 @@ namespace neat_dnfs
 
 			for (int i = 0; i < steps_t; i++)
 			{
-				phenotype.step();
+				stepPhenotype();
 			}
 		} while (std::abs(newPosition - targetPosition) > epsilon);
 	}
 
-	double Solution::negativeBaseline(const std::string& fieldName) const
+	double Solution::negativeBaseline(const FieldSnapshot& snapshot)
 	{
-		const auto neuralField = getNeuralFieldOrThrow(fieldName, "negativeBaseline");
-
-		const double startingRestingLevel = neuralField->getParameters().startingRestingLevel;
-		const double maxActivation = neuralField->getHighestActivation();
+		const double startingRestingLevel = snapshot.restingLevel;
+		const double maxActivation = snapshot.highestActivation;
 
 		const double targetBaseline = startingRestingLevel * 2;
 		const double width = std::abs(maxActivation / 8);
@@ -0,0 +1,114 @@
+#include "neat/solution_pool.h"
+
+#include <exception>
+#include <format>
+
+namespace neat_dnfs
+{
+	const std::shared_ptr<SolutionPool>& SolutionPool::instance()
+	{
+		static const auto pool = std::make_shared<SolutionPool>();
+		return pool;
+	}
+
+	void SolutionPool::setCapacity(const size_t capacity)
+	{
+		std::vector<std::unique_ptr<Solution>> freed;
+		{
+			std::lock_guard lock(mutex);
+			this->capacity = capacity;
+			for (auto& [type, solutions] : idle)
+			{
+				while (solutions.size() > capacity)
+				{
+					freed.push_back(std::move(solutions.back()));
+					solutions.pop_back();
+				}
+			}
+		}
+	}
+
+	size_t SolutionPool::getCapacity() const
+	{
+		std::lock_guard lock(mutex);
+		return capacity;
+	}
+
+	size_t SolutionPool::getIdle() const
+	{
+		std::lock_guard lock(mutex);
+		size_t count = 0;
+		for (const auto& [type, solutions] : idle)
+		{
+			count += solutions.size();
+		}
+		return count;
+	}
+
+	size_t SolutionPool::getCreated() const
+	{
+		std::lock_guard lock(mutex);
+		return created;
+	}
+
+	size_t SolutionPool::getRecycled() const
+	{
+		std::lock_guard lock(mutex);
+		return recycled;
+	}
+
+	void SolutionPool::clear()
+	{
+		std::unordered_map<std::type_index, std::vector<std::unique_ptr<Solution>>> freed;
+		{
+			std::lock_guard lock(mutex);
+			freed.swap(idle);
+			created = 0;
+			recycled = 0;
+		}
+	}
+
+	std::unique_ptr<Solution> SolutionPool::take(const std::type_index type)
+	{
+		std::lock_guard lock(mutex);
+		const auto solutions = idle.find(type);
+		if (solutions == idle.end() || solutions->second.empty())
+		{
+			++created;
+			return nullptr;
+		}
+		std::unique_ptr<Solution> solution = std::move(solutions->second.back());
+		solutions->second.pop_back();
+		++recycled;
+		return solution;
+	}
+
+	void SolutionPool::release(Solution* solution)
+	{
+		// Declared before the lock so that, when the pool is full, the solution
+		// is destroyed after the lock is released.
+		std::unique_ptr<Solution> owned(solution);
+		// A persistent phenotype would keep its whole simulation alive for as
+		// long as the solution stays parked. The genome is left as it is, so
+		// its vectors keep their capacity until reinitialize() clears them.
+		if (solution->hasPhenotype() || !solution->getPhenotype().getElements().empty())
+		{
+			try
+			{
+				solution->clearPhenotype();
+			}
+			catch (const std::exception& error)
+			{
+				tools::logger::log(tools::logger::LogLevel::ERROR, std::format(
+					"Freeing a solution whose phenotype could not be cleared instead of parking it: {}", error.what()));
+				return;
+			}
+		}
+		std::lock_guard lock(mutex);
+		auto& solutions = idle[typeid(*solution)];
+		if (solutions.size() < capacity)
+		{
+			solutions.push_back(std::move(owned));
+		}
+	}
+}
@@ -163,12 +163,13 @@ namespace neat_dnfs
 		const auto& representativeGenome = representative->getGenome();
 		const auto& solutionGenome = solution->getGenome();
 
+		const CompatibilityTerms terms = representativeGenome.compatibilityTerms(solutionGenome);
 		const double excessCoefficient = CompatibilityCoefficients::excessGenesCompatibilityWeight
-			* representativeGenome.excessGenes(solutionGenome);
+			* terms.excessGenes;
 		const double disjointCoefficient = CompatibilityCoefficients::disjointGenesCompatibilityWeight
-			* representativeGenome.disjointGenes(solutionGenome);
+			* terms.disjointGenes;
 		const double weightCoefficient = CompatibilityCoefficients::averageConnectionDifferenceCompatibilityWeight
-			* representativeGenome.averageConnectionDifference(solutionGenome);
+			* terms.averageConnectionDifference;
 
 		const double geneticDistance = (excessCoefficient + disjointCoefficient + weightCoefficient) / N;
 
@@ -307,4 +308,69 @@ namespace neat_dnfs
 	{
 		tools::logger::log(tools::logger::INFO, toString());
 	}
+
+	void Species::serialize(tools::BinaryWriter& writer, const std::function<std::int32_t(const SolutionPtr&)>& indexOf) const
+	{
+		const auto writeSolutions = [&writer, &indexOf](const std::vector<SolutionPtr>& list)
+			{
+				writer.write(static_cast<std::uint64_t>(list.size()));
+				for (const auto& solution : list)
+				{
+					writer.write(indexOf(solution));
+				}
+			};
+
+		writer.write(static_cast<std::int32_t>(id));
+		writer.write(static_cast<std::int32_t>(offspringCount));
+		writer.write(indexOf(representative));
+		writer.write(indexOf(champion));
+		// Offspring are only read between crossover() and
+		// replaceMembersWithOffspring(), never across generations.
+		writeSolutions(members);
+		writer.write(extinct);
+		writer.write(static_cast<std::int32_t>(age));
+		writer.write(hasFitnessImproved);
+		writer.write(static_cast<std::int32_t>(generationsSinceFitnessImproved));
+	}
+
+	std::shared_ptr<Species> Species::deserialize(tools::BinaryReader& reader, const std::vector<SolutionPtr>& solutions)
+	{
+		const auto readSolution = [&reader, &solutions]() -> SolutionPtr
+			{
+				const auto index = reader.read<std::int32_t>();
+				if (index == -1)
+				{
+					return nullptr;
+				}
+				if (index < 0 || static_cast<size_t>(index) >= solutions.size())
+				{
+					throw std::runtime_error(std::format("Species::deserialize() - Solution index {} out of range.", index));
+				}
+				return solutions[index];
+			};
+		const auto readSolutions = [&reader, &readSolution]()
+			{
+				std::vector<SolutionPtr> list(reader.readSequenceSize(sizeof(std::int32_t)));
+				for (auto& solution : list)
+				{
+					solution = readSolution();
+				}
+				return list;
+			};
+
+		const int counter = currentSpeciesId;
+		auto species = std::make_shared<Species>();
+		currentSpeciesId = counter;
+
+		species->id = reader.read<std::int32_t>();
+		species->offspringCount = reader.read<std::int32_t>();
+		species->representative = readSolution();
+		species->champion = readSolution();
+		species->members = readSolutions();
+		species->extinct = reader.read<bool>();
+		species->age = reader.read<std::int32_t>();
+		species->hasFitnessImproved = reader.read<bool>();
+		species->generationsSinceFitnessImproved = reader.read<std::int32_t>();
+		return species;
+	}
 }
@@ -0,0 +1,52 @@
+#include "neat/tape_noise.h"
+
+#include <cmath>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace neat_dnfs
+{
+	TapeNoise::TapeNoise(const dnf_composer::element::ElementCommonParameters& elementCommonParameters,
+		const dnf_composer::element::NormalNoiseParameters& parameters,
+		std::shared_ptr<const tools::NoiseTape> tape, const size_t lane)
+		: NormalNoise(elementCommonParameters, parameters), tape(std::move(tape)), lane(lane)
+	{
+		if (!this->tape)
+		{
+			throw std::invalid_argument("TapeNoise needs a noise tape.");
+		}
+	}
+
+	void TapeNoise::step(double /*t*/, const double deltaT)
+	{
+		auto& output = components.at("output");
+		const std::span<const double> draws = tape->row(stepIndex++, lane);
+		if (draws.size() < output.size())
+		{
+			throw std::runtime_error(std::format("A noise tape {} samples wide can't feed {} of size {}.",
+				draws.size(), getUniqueName(), output.size()));
+		}
+		const double scale = getParameters().amplitude / std::sqrt(deltaT);
+		for (size_t x = 0; x < output.size(); ++x)
+		{
+			output[x] = scale * draws[x];
+		}
+	}
+
+	std::shared_ptr<dnf_composer::element::Element> TapeNoise::clone() const
+	{
+		return std::make_shared<TapeNoise>(*this);
+	}
+
+	void TapeNoise::setTape(std::shared_ptr<const tools::NoiseTape> tape)
+	{
+		if (!tape)
+		{
+			throw std::invalid_argument("TapeNoise needs a noise tape.");
+		}
+		this->tape = std::move(tape);
+		stepIndex = 0;
+	}
+}
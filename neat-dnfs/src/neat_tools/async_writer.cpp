@@ -0,0 +1,107 @@
+#include "neat_tools/async_writer.h"
+
+#include <string>
+#include <utility>
+
+#include "neat_tools/logger.h"
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		AsyncWriter::AsyncWriter()
+			: thread([this]() { run(); })
+		{}
+
+		AsyncWriter::~AsyncWriter()
+		{
+			{
+				std::lock_guard lock(mutex);
+				stopping = true;
+			}
+			jobAvailable.notify_one();
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+
+			if (firstError)
+			{
+				try
+				{
+					std::rethrow_exception(firstError);
+				}
+				catch (const std::exception& error)
+				{
+					logger::log(logger::LogLevel::ERROR, std::string("Background write failed: ") + error.what());
+				}
+				catch (...)
+				{
+					logger::log(logger::LogLevel::ERROR, "Background write failed with an unknown exception.");
+				}
+			}
+		}
+
+		void AsyncWriter::enqueue(std::function<void()> job)
+		{
+			{
+				std::lock_guard lock(mutex);
+				jobs.push_back(std::move(job));
+			}
+			jobAvailable.notify_one();
+		}
+
+		void AsyncWriter::flush()
+		{
+			std::exception_ptr error;
+			{
+				std::unique_lock lock(mutex);
+				drained.wait(lock, [this]() { return jobs.empty() && !busy; });
+				error = std::exchange(firstError, nullptr);
+			}
+			if (error)
+			{
+				std::rethrow_exception(error);
+			}
+		}
+
+		void AsyncWriter::run()
+		{
+			std::unique_lock lock(mutex);
+			while (true)
+			{
+				jobAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+				if (jobs.empty())
+				{
+					return; // stopping, and everything queued has been written
+				}
+
+				std::function<void()> job = std::move(jobs.front());
+				jobs.pop_front();
+				busy = true;
+				lock.unlock();
+
+				std::exception_ptr error;
+				try
+				{
+					job();
+				}
+				catch (...)
+				{
+					error = std::current_exception();
+				}
+
+				lock.lock();
+				busy = false;
+				if (error && !firstError)
+				{
+					firstError = error;
+				}
+				if (jobs.empty())
+				{
+					drained.notify_all();
+				}
+			}
+		}
+	}
+}
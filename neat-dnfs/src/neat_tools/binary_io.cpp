@@ -0,0 +1,62 @@
+#include "neat_tools/binary_io.h"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		void BinaryWriter::writeString(const std::string& value)
+		{
+			write(static_cast<std::uint64_t>(value.size()));
+			out.write(value.data(), static_cast<std::streamsize>(value.size()));
+		}
+
+		std::string BinaryReader::readString()
+		{
+			std::string value(readSequenceSize(1), '\0');
+			readBytes(value.data(), value.size());
+			return value;
+		}
+
+		size_t BinaryReader::readSequenceSize(const size_t elementSize)
+		{
+			const auto size = read<std::uint64_t>();
+			if (elementSize != 0 && size > maxSequenceBytes / elementSize)
+			{
+				throw std::runtime_error(std::format("Corrupt data: sequence of {} elements.", size));
+			}
+			return static_cast<size_t>(size);
+		}
+
+		void BinaryReader::readBytes(char* destination, const size_t count)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+			if (!in.read(destination, static_cast<std::streamsize>(count)))
+			{
+				throw std::runtime_error("Unexpected end of data.");
+			}
+		}
+
+		void writeFileAtomically(const std::string& filePath, const std::string& contents)
+		{
+			const std::string temporaryPath = filePath + ".tmp";
+			{
+				std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+				file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+				file.close();
+				if (!file)
+				{
+					throw std::runtime_error(std::format("Failed to write {}.", temporaryPath));
+				}
+			}
+			std::filesystem::rename(temporaryPath, filePath);
+		}
+	}
+}
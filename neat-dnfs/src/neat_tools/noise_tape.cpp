@@ -0,0 +1,38 @@
+#include "neat_tools/noise_tape.h"
+
+#include <random>
+#include <stdexcept>
+
+#include "neat_tools/utils.h"
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		NoiseTape::NoiseTape(const size_t numSteps, const size_t width, const std::uint64_t seed)
+			: numSteps(numSteps), width(width), seed(seed)
+		{
+			if (numSteps == 0 || width == 0)
+			{
+				throw std::invalid_argument("A noise tape needs at least one step and one sample.");
+			}
+			utils::Xoshiro256pp engine(seed);
+			std::normal_distribution<double> distribution(0.0, 1.0);
+			samples.resize(numSteps * width);
+			for (double& sample : samples)
+			{
+				sample = distribution(engine);
+			}
+		}
+
+		std::span<const double> NoiseTape::row(const size_t step, const size_t lane) const
+		{
+			// Hashing the lane spreads the starting rows of consecutive ids over
+			// the whole tape instead of lining them up one row apart.
+			std::uint64_t start = seed;
+			utils::hashCombine(start, static_cast<std::uint64_t>(lane));
+			const size_t index = (static_cast<size_t>(start % numSteps) + step) % numSteps;
+			return { samples.data() + index * width, width };
+		}
+	}
+}
@@ -0,0 +1,167 @@
+#include "neat_tools/profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		std::string_view phaseName(const Phase phase)
+		{
+			switch (phase)
+			{
+			case Phase::Evaluate: return "evaluate";
+			case Phase::BuildPhenotype: return "buildPhenotype";
+			case Phase::TestPhenotype: return "testPhenotype";
+			case Phase::ClearPhenotype: return "clearPhenotype";
+			case Phase::Speciate: return "speciate";
+			case Phase::Upkeep: return "upkeep";
+			case Phase::Validation: return "validation";
+			case Phase::FileIO: return "fileIO";
+			case Phase::ReproduceAndSelect: return "reproduceAndSelect";
+			case Phase::Count: break;
+			}
+			return "unknown";
+		}
+
+		void PhaseHistogram::add(const std::uint64_t nanoseconds)
+		{
+			minNanoseconds = count == 0 ? nanoseconds : std::min(minNanoseconds, nanoseconds);
+			maxNanoseconds = std::max(maxNanoseconds, nanoseconds);
+			++count;
+			totalNanoseconds += nanoseconds;
+
+			const std::uint64_t microseconds = nanoseconds / 1000;
+			const size_t bucket = microseconds == 0 ? 0 : static_cast<size_t>(std::bit_width(microseconds)) - 1;
+			++buckets[std::min(bucket, numBuckets - 1)];
+		}
+
+		std::uint64_t PhaseHistogram::quantileNanoseconds(const double quantile) const
+		{
+			if (count == 0)
+			{
+				return 0;
+			}
+			const auto rank = std::max<std::uint64_t>(1,
+				static_cast<std::uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(count))));
+			std::uint64_t seen = 0;
+			for (size_t bucket = 0; bucket < numBuckets; ++bucket)
+			{
+				seen += buckets[bucket];
+				if (seen >= rank)
+				{
+					return std::min(maxNanoseconds, (std::uint64_t{ 2 } << bucket) * 1000);
+				}
+			}
+			return maxNanoseconds;
+		}
+
+		double PhaseHistogram::meanNanoseconds() const
+		{
+			return count == 0 ? 0.0 : static_cast<double>(totalNanoseconds) / static_cast<double>(count);
+		}
+
+		Profiler& Profiler::instance()
+		{
+			static Profiler profiler;
+			return profiler;
+		}
+
+		Profiler::ThreadBuffer& Profiler::threadBuffer()
+		{
+			thread_local std::shared_ptr<ThreadBuffer> buffer;
+			if (!buffer)
+			{
+				buffer = std::make_shared<ThreadBuffer>();
+				const std::lock_guard lock(mutex);
+				buffer->thread = nextThread++;
+				buffers.push_back(buffer);
+			}
+			return *buffer;
+		}
+
+		void Profiler::record(const Phase phase, const Clock::time_point start, const Clock::time_point end)
+		{
+			ThreadBuffer& buffer = threadBuffer();
+			const Event event{ phase, buffer.thread,
+				std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch).count(),
+				std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() };
+			const std::lock_guard lock(buffer.mutex);
+			buffer.events.push_back(event);
+		}
+
+		PhaseProfile Profiler::collect()
+		{
+			PhaseProfile profile{};
+			std::vector<Event> events;
+			const std::lock_guard lock(mutex);
+			for (const auto& buffer : buffers)
+			{
+				{
+					const std::lock_guard bufferLock(buffer->mutex);
+					events.swap(buffer->events);
+				}
+				for (const Event& event : events)
+				{
+					profile[static_cast<size_t>(event.phase)].add(static_cast<std::uint64_t>(std::max<std::int64_t>(0, event.durationNanoseconds)));
+				}
+				if (tracing)
+				{
+					trace.insert(trace.end(), events.begin(), events.end());
+				}
+				events.clear();
+			}
+			// The registry holds the only reference left to the buffer of a
+			// thread that has exited, and it was just drained.
+			std::erase_if(buffers, [](const std::shared_ptr<ThreadBuffer>& buffer) { return buffer.use_count() == 1; });
+			return profile;
+		}
+
+		void Profiler::setTracing(const bool enabled)
+		{
+			const std::lock_guard lock(mutex);
+			tracing = enabled;
+		}
+
+		bool Profiler::isTracing() const
+		{
+			const std::lock_guard lock(mutex);
+			return tracing;
+		}
+
+		void Profiler::writeChromeTrace(std::ostream& out) const
+		{
+			const std::lock_guard lock(mutex);
+			out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+			for (size_t i = 0; i < trace.size(); ++i)
+			{
+				const Event& event = trace[i];
+				out << (i == 0 ? "\n" : ",\n")
+					<< std::format(R"({{"name":"{}","cat":"neat-dnfs","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+						phaseName(event.phase), event.thread,
+						static_cast<double>(event.startNanoseconds) / 1000.0,
+						static_cast<double>(event.durationNanoseconds) / 1000.0);
+			}
+			out << "\n]}\n";
+		}
+
+		void Profiler::clearTrace()
+		{
+			const std::lock_guard lock(mutex);
+			trace.clear();
+			trace.shrink_to_fit();
+		}
+
+		ScopedPhaseTimer::ScopedPhaseTimer(const Phase phase)
+			: phase(phase), start(Profiler::Clock::now())
+		{}
+
+		ScopedPhaseTimer::~ScopedPhaseTimer()
+		{
+			Profiler::instance().record(phase, start, Profiler::Clock::now());
+		}
+	}
+}
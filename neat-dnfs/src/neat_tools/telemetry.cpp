@@ -0,0 +1,232 @@
+#include "neat_tools/telemetry.h"
+
+#include <algorithm>
+#include <bit>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+
+#include "neat_tools/binary_io.h"
+#include "neat_tools/logger.h"
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		namespace
+		{
+			constexpr std::uint64_t maxColumns = 1024;
+
+			// Calls onBatch(rows, values) for every complete batch after the
+			// header, values holding the batch column after column.
+			// @return The offset just past the last complete batch.
+			template <typename OnBatch>
+			std::streamoff scanBatches(std::istream& in, const size_t numColumns, OnBatch&& onBatch)
+			{
+				std::streamoff end = in.tellg();
+				std::vector<std::uint64_t> values;
+				while (true)
+				{
+					std::uint64_t rows = 0;
+					if (!in.read(reinterpret_cast<char*>(&rows), sizeof(rows)))
+					{
+						break;
+					}
+					if (numColumns != 0 && rows > BinaryReader::maxSequenceBytes / (numColumns * sizeof(std::uint64_t)))
+					{
+						break;
+					}
+					values.resize(static_cast<size_t>(rows) * numColumns);
+					if (!in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(std::uint64_t))))
+					{
+						break;
+					}
+					onBatch(static_cast<size_t>(rows), values);
+					end = in.tellg();
+				}
+				return end;
+			}
+		}
+
+		std::uint64_t TelemetryValue::encode(const TelemetryColumnType type) const
+		{
+			if (type == TelemetryColumnType::Float64)
+			{
+				const double number = std::visit([](const auto v) { return static_cast<double>(v); }, value);
+				return std::bit_cast<std::uint64_t>(number);
+			}
+			const std::int64_t number = std::visit([](const auto v) { return static_cast<std::int64_t>(v); }, value);
+			return std::bit_cast<std::uint64_t>(number);
+		}
+
+		TelemetryWriter::TelemetryWriter(std::string filePath, std::vector<TelemetryColumn> schema, const size_t batchRows)
+			: filePath(std::move(filePath)), schema(std::move(schema)), batchRows(std::max<size_t>(1, batchRows)),
+			columns(this->schema.size())
+		{
+			const bool exists = std::filesystem::exists(this->filePath) && std::filesystem::file_size(this->filePath) > 0;
+			if (exists)
+			{
+				std::streamoff end = 0;
+				{
+					std::ifstream existing(this->filePath, std::ios::binary);
+					if (readTelemetrySchema(existing) != this->schema)
+					{
+						throw std::runtime_error(std::format("{} holds telemetry of a different schema.", this->filePath));
+					}
+					end = scanBatches(existing, this->schema.size(), [](size_t, const std::vector<std::uint64_t>&) {});
+				}
+				if (static_cast<std::uintmax_t>(end) != std::filesystem::file_size(this->filePath))
+				{
+					std::filesystem::resize_file(this->filePath, static_cast<std::uintmax_t>(end));
+				}
+			}
+
+			file.open(this->filePath, std::ios::binary | std::ios::app);
+			if (!file.is_open())
+			{
+				throw std::runtime_error(std::format("Failed to open {}.", this->filePath));
+			}
+			if (!exists)
+			{
+				BinaryWriter writer(file);
+				file.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+				writer.write(version);
+				writer.write(static_cast<std::uint32_t>(this->schema.size()));
+				for (const TelemetryColumn& column : this->schema)
+				{
+					writer.write(column.type);
+					writer.writeString(column.name);
+				}
+				file.flush();
+			}
+			for (auto& column : columns)
+			{
+				column.reserve(this->batchRows);
+			}
+		}
+
+		TelemetryWriter::~TelemetryWriter()
+		{
+			try
+			{
+				flush();
+			}
+			catch (const std::exception& error)
+			{
+				logger::log(logger::LogLevel::ERROR, std::string("Failed to write telemetry: ") + error.what());
+			}
+		}
+
+		void TelemetryWriter::append(const std::span<const TelemetryValue> row)
+		{
+			if (row.size() != schema.size())
+			{
+				throw std::invalid_argument(std::format("Telemetry record of {} values for {} columns.", row.size(), schema.size()));
+			}
+			for (size_t c = 0; c < row.size(); ++c)
+			{
+				columns[c].push_back(row[c].encode(schema[c].type));
+			}
+			if (getBufferedRows() >= batchRows)
+			{
+				flush();
+			}
+		}
+
+		void TelemetryWriter::flush()
+		{
+			const size_t rows = getBufferedRows();
+			if (rows == 0)
+			{
+				return;
+			}
+			BinaryWriter writer(file);
+			writer.write(static_cast<std::uint64_t>(rows));
+			for (auto& column : columns)
+			{
+				file.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(column.size() * sizeof(std::uint64_t)));
+				column.clear();
+			}
+			file.flush();
+			if (!file)
+			{
+				throw std::runtime_error(std::format("Failed to write {}.", filePath));
+			}
+		}
+
+		size_t TelemetryTable::columnIndex(const std::string& name) const
+		{
+			const auto it = std::ranges::find(schema, name, &TelemetryColumn::name);
+			if (it == schema.end())
+			{
+				throw std::out_of_range(std::format("No telemetry column named {}.", name));
+			}
+			return static_cast<size_t>(it - schema.begin());
+		}
+
+		std::int64_t TelemetryTable::int64At(const std::string& column, const size_t row) const
+		{
+			return std::bit_cast<std::int64_t>(columns.at(columnIndex(column)).at(row));
+		}
+
+		double TelemetryTable::float64At(const std::string& column, const size_t row) const
+		{
+			return std::bit_cast<double>(columns.at(columnIndex(column)).at(row));
+		}
+
+		std::vector<TelemetryColumn> readTelemetrySchema(std::istream& in)
+		{
+			try
+			{
+				std::array<char, TelemetryWriter::magic.size()> header{};
+				BinaryReader reader(in);
+				if (!in.read(header.data(), static_cast<std::streamsize>(header.size())) || header != TelemetryWriter::magic)
+				{
+					throw std::runtime_error("Not a telemetry file.");
+				}
+				if (reader.read<std::uint32_t>() != TelemetryWriter::version)
+				{
+					throw std::runtime_error("Unsupported telemetry version.");
+				}
+				const auto numColumns = reader.read<std::uint32_t>();
+				if (numColumns > maxColumns)
+				{
+					throw std::runtime_error(std::format("Corrupt telemetry header: {} columns.", numColumns));
+				}
+				std::vector<TelemetryColumn> schema;
+				schema.reserve(numColumns);
+				for (std::uint32_t c = 0; c < numColumns; ++c)
+				{
+					const auto type = reader.read<TelemetryColumnType>();
+					if (type != TelemetryColumnType::Int64 && type != TelemetryColumnType::Float64)
+					{
+						throw std::runtime_error("Corrupt telemetry header: unknown column type.");
+					}
+					schema.push_back({ reader.readString(), type });
+				}
+				return schema;
+			}
+			catch (const std::runtime_error& error)
+			{
+				throw std::runtime_error(std::string("Invalid telemetry file: ") + error.what());
+			}
+		}
+
+		TelemetryTable readTelemetry(std::istream& in)
+		{
+			TelemetryTable table;
+			table.schema = readTelemetrySchema(in);
+			table.columns.resize(table.schema.size());
+			const size_t numColumns = table.schema.size();
+			scanBatches(in, numColumns, [&table, numColumns](const size_t rows, const std::vector<std::uint64_t>& values)
+				{
+					for (size_t c = 0; c < numColumns; ++c)
+					{
+						const auto first = values.begin() + static_cast<std::ptrdiff_t>(c * rows);
+						table.columns[c].insert(table.columns[c].end(), first, first + static_cast<std::ptrdiff_t>(rows));
+					}
+				});
+			return table;
+		}
+	}
+}
@@ -0,0 +1,303 @@
+#include "neat_tools/thread_pool.h"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "neat_tools/logger.h"
+
+namespace neat_dnfs
+{
+	namespace tools
+	{
+		namespace
+		{
+			// Which pool (if any) the current thread works for, and its index there.
+			thread_local const ThreadPool* currentPool = nullptr;
+			thread_local size_t currentWorker = std::numeric_limits<size_t>::max();
+		}
+
+		ThreadPool::ThreadPool(size_t numWorkers, const bool pinThreads)
+			: pinThreads(pinThreads)
+		{
+			if (numWorkers == 0)
+			{
+				numWorkers = std::max(1U, std::thread::hardware_concurrency());
+			}
+
+			workers.reserve(numWorkers);
+			for (size_t i = 0; i < numWorkers; ++i)
+			{
+				workers.emplace_back(std::make_unique<Worker>());
+			}
+			// Threads start only once every worker exists, since any of them may
+			// try to steal from any other as soon as it runs.
+			for (size_t i = 0; i < numWorkers; ++i)
+			{
+				workers[i]->thread = std::thread([this, i]() { workerLoop(i); });
+			}
+		}
+
+		ThreadPool::~ThreadPool()
+		{
+			{
+				std::lock_guard lock(sleepMutex);
+				stopping = true;
+			}
+			workAvailable.notify_all();
+			for (const auto& worker : workers)
+			{
+				if (worker->thread.joinable())
+				{
+					worker->thread.join();
+				}
+			}
+		}
+
+		void ThreadPool::submit(TaskGroup& group, std::function<void()> work)
+		{
+			group.pending.fetch_add(1, std::memory_order_relaxed);
+
+			const size_t target = isWorkerThread()
+				? currentWorker
+				: nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+			Worker& worker = *workers[target];
+			{
+				std::lock_guard lock(worker.mutex);
+				worker.deque.push_back(Task{ std::move(work), &group });
+				const size_t depth = worker.deque.size();
+				if (depth > worker.peakQueueDepth.load(std::memory_order_relaxed))
+				{
+					worker.peakQueueDepth.store(depth, std::memory_order_relaxed);
+				}
+			}
+			queuedTasks.fetch_add(1, std::memory_order_release);
+
+			// Taking the lock orders this against a worker that just found no work
+			// and is about to sleep, so the wake-up can't be lost.
+			{
+				std::lock_guard lock(sleepMutex);
+			}
+			workAvailable.notify_one();
+		}
+
+		void ThreadPool::wait(TaskGroup& group)
+		{
+			if (isWorkerThread())
+			{
+				// Help instead of blocking: the tasks this group waits on may be
+				// sitting in this very worker's deque.
+				while (!group.done())
+				{
+					if (!tryRunOne(currentWorker))
+					{
+						std::this_thread::yield();
+					}
+				}
+			}
+			else
+			{
+				std::unique_lock lock(sleepMutex);
+				taskCompleted.wait(lock, [&group]() { return group.done(); });
+			}
+
+			std::exception_ptr error;
+			{
+				std::lock_guard lock(group.errorMutex);
+				error = std::exchange(group.firstError, nullptr);
+			}
+			if (error)
+			{
+				std::rethrow_exception(error);
+			}
+		}
+
+		void ThreadPool::parallelFor(const size_t count, const std::function<void(size_t)>& body)
+		{
+			TaskGroup group;
+			for (size_t i = 0; i < count; ++i)
+			{
+				submit(group, [&body, i]() { body(i); });
+			}
+			wait(group);
+		}
+
+		bool ThreadPool::isWorkerThread() const
+		{
+			return currentPool == this;
+		}
+
+		std::vector<WorkerStatistics> ThreadPool::getWorkerStatistics() const
+		{
+			std::vector<WorkerStatistics> statistics;
+			statistics.reserve(workers.size());
+			for (const auto& worker : workers)
+			{
+				WorkerStatistics entry;
+				{
+					std::lock_guard lock(worker->mutex);
+					entry.queueDepth = worker->deque.size();
+				}
+				entry.peakQueueDepth = worker->peakQueueDepth.load(std::memory_order_relaxed);
+				entry.tasksExecuted = worker->tasksExecuted.load(std::memory_order_relaxed);
+				entry.tasksStolen = worker->tasksStolen.load(std::memory_order_relaxed);
+				entry.idleTime = std::chrono::nanoseconds(worker->idleNanoseconds.load(std::memory_order_relaxed));
+				statistics.push_back(entry);
+			}
+			return statistics;
+		}
+
+		void ThreadPool::resetStatistics()
+		{
+			for (const auto& worker : workers)
+			{
+				worker->peakQueueDepth = 0;
+				worker->tasksExecuted = 0;
+				worker->tasksStolen = 0;
+				worker->idleNanoseconds = 0;
+			}
+		}
+
+		void ThreadPool::workerLoop(const size_t index)
+		{
+			currentPool = this;
+			currentWorker = index;
+			if (pinThreads)
+			{
+				pinCurrentThread(index);
+			}
+
+			Worker& self = *workers[index];
+			while (true)
+			{
+				if (tryRunOne(index))
+				{
+					continue;
+				}
+
+				const auto idleStart = std::chrono::steady_clock::now();
+				{
+					std::unique_lock lock(sleepMutex);
+					workAvailable.wait(lock, [this]()
+						{
+							return stopping.load() || queuedTasks.load(std::memory_order_acquire) > 0;
+						});
+				}
+				self.idleNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - idleStart).count(), std::memory_order_relaxed);
+
+				if (stopping && queuedTasks.load(std::memory_order_acquire) == 0)
+				{
+					return;
+				}
+			}
+		}
+
+		void ThreadPool::pinCurrentThread(const size_t index) const
+		{
+#if defined(__linux__)
+			const unsigned cpuCount = std::max(1U, std::thread::hardware_concurrency());
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			CPU_SET(index % cpuCount, &cpuSet);
+			if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0)
+			{
+				logger::log(logger::LogLevel::WARNING, std::format("Could not pin thread pool worker {} to CPU {}.", index, index % cpuCount));
+			}
+#else
+			if (index == 0)
+			{
+				logger::log(logger::LogLevel::WARNING, "Thread pinning is only supported on Linux; worker threads are left unpinned.");
+			}
+#endif
+		}
+
+		bool ThreadPool::tryRunOne(const size_t self)
+		{
+			Task task;
+			bool found = false;
+			bool stolen = false;
+
+			if (self < workers.size())
+			{
+				Worker& own = *workers[self];
+				std::lock_guard lock(own.mutex);
+				if (!own.deque.empty())
+				{
+					task = std::move(own.deque.back());
+					own.deque.pop_back();
+					found = true;
+				}
+			}
+
+			for (size_t offset = 1; !found && offset <= workers.size(); ++offset)
+			{
+				const size_t victimIndex = (self + offset) % workers.size();
+				if (victimIndex == self)
+				{
+					continue;
+				}
+				Worker& victim = *workers[victimIndex];
+				std::lock_guard lock(victim.mutex);
+				if (!victim.deque.empty())
+				{
+					task = std::move(victim.deque.front());
+					victim.deque.pop_front();
+					found = stolen = true;
+				}
+			}
+
+			if (!found)
+			{
+				return false;
+			}
+
+			queuedTasks.fetch_sub(1, std::memory_order_acq_rel);
+			if (self < workers.size())
+			{
+				workers[self]->tasksExecuted.fetch_add(1, std::memory_order_relaxed);
+				if (stolen)
+				{
+					workers[self]->tasksStolen.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			run(task);
+			return true;
+		}
+
+		void ThreadPool::run(Task& task)
+		{
+			try
+			{
+				task.work();
+			}
+			catch (...)
+			{
+				std::lock_guard lock(task.group->errorMutex);
+				if (!task.group->firstError)
+				{
+					task.group->firstError = std::current_exception();
+				}
+			}
+
+			if (task.group->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				notifyCompletion();
+			}
+		}
+
+		void ThreadPool::notifyCompletion()
+		{
+			{
+				std::lock_guard lock(sleepMutex);
+			}
+			taskCompleted.notify_all();
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include "solutions/and.h"
+#include "neat/solution_pool.h"
 
 namespace neat_dnfs
 {
@@ -16,10 +17,7 @@ namespace neat_dnfs
 
 	SolutionPtr AND::clone() const
 	{
-		AND solution(initialTopology);
-		auto clonedSolution = std::make_shared<AND>(solution);
-
-		return clonedSolution;
+		return SolutionPool::make<AND>(initialTopology);
 	}
 
 	SolutionPtr AND::copy() const
@@ -33,74 +31,79 @@ namespace neat_dnfs
 	void AND::testPhenotype()
 	{
 		using namespace dnf_composer::element;
-		parameters.fitness = 0.0;
-		parameters.partialFitness.clear();
+		const FieldHandle nf1 = fieldHandle("nf 1");
+		const FieldHandle nf2 = fieldHandle("nf 2");
+		const FieldHandle nf3 = fieldHandle("nf 3");
+
+		static constexpr double wf1_1 = 0.10;
+		static constexpr double wf1_2 = 0.20;
+		static constexpr double wf2_1 = 0.10;
+		static constexpr double wf2_2 = 0.20;
+		static constexpr double wf3 = 0.25;
+		static constexpr double wf4_1 = 0.05;
+		static constexpr double wf4_2 = 0.05;
+		static constexpr double wf4_3 = 0.05;
+		declarePartialFitnessWeights({ wf1_1, wf1_2, wf2_1, wf2_2, wf3, wf4_1, wf4_2, wf4_3 });
 
 		static constexpr int iterations = SimulationConstants::maxSimulationSteps;
 
 		initSimulation();
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
 				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 
 		runSimulation(iterations);
 
-		const double f1_1 = oneBumpAtPositionWithAmplitudeAndWidth("nf 1", 50.0, 15, 10);
-		const double f1_2 = noBumps("nf 3");
-		parameters.partialFitness.emplace_back(f1_1);
-		parameters.partialFitness.emplace_back(f1_2);
+		const double f1_1 = oneBumpAtPositionWithAmplitudeAndWidth(nf1, 50.0, 15, 10);
+		const double f1_2 = noBumps(nf3);
+		recordPartialFitness(f1_1);
+		recordPartialFitness(f1_2);
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		removeGaussianStimuli();
-		addGaussianStimulus("nf 2",
+		addGaussianStimulus(nf2,
 dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
 	GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 
 		runSimulation(iterations);
 
-		const double f2_1 = oneBumpAtPositionWithAmplitudeAndWidth("nf 2", 50.0, 15, 10);
-		const double f2_2 = noBumps("nf 3");
-		parameters.partialFitness.emplace_back(f2_1);
-		parameters.partialFitness.emplace_back(f2_2);
+		const double f2_1 = oneBumpAtPositionWithAmplitudeAndWidth(nf2, 50.0, 15, 10);
+		const double f2_2 = noBumps(nf3);
+		recordPartialFitness(f2_1);
+		recordPartialFitness(f2_2);
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
 	GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 
 		runSimulation(iterations);
 
-		const double f3 = oneBumpAtPositionWithAmplitudeAndWidth("nf 3", 50.0, 10, 10);
-		parameters.partialFitness.emplace_back(f3);
+		const double f3 = oneBumpAtPositionWithAmplitudeAndWidth(nf3, 50.0, 10, 10);
+		recordPartialFitness(f3);
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		removeGaussianStimuli();
 		runSimulation(iterations);
 
-		const double f4_1 = closenessToRestingLevel("nf 1");
-		const double f4_2 = closenessToRestingLevel("nf 2");
-		const double f4_3 = closenessToRestingLevel("nf 3");
-		parameters.partialFitness.emplace_back(f4_1);
-		parameters.partialFitness.emplace_back(f4_2);
-		parameters.partialFitness.emplace_back(f4_3);
-
-
-		static constexpr double wf1_1 = 0.10;
-		static constexpr double wf1_2 = 0.20; 
-
-		static constexpr double wf2_1 = 0.10;
-		static constexpr double wf2_2 = 0.20; 
-
-		static constexpr double wf3 = 0.25;
-
-		static constexpr double wf4_1 = 0.05;
-		static constexpr double wf4_2 = 0.05;
-		static constexpr double wf4_3 = 0.05;
-
-		parameters.fitness = wf1_1 * f1_1 + wf1_2 * f1_2 +
-			wf2_1 * f2_1 + wf2_2 * f2_2 +
-			wf3 * f3 +
-			wf4_1 * f4_1 + wf4_2 * f4_2 + wf4_3 * f4_3;
+		const double f4_1 = closenessToRestingLevel(nf1);
+		const double f4_2 = closenessToRestingLevel(nf2);
+		const double f4_3 = closenessToRestingLevel(nf3);
+		recordPartialFitness(f4_1);
+		recordPartialFitness(f4_2);
+		recordPartialFitness(f4_3);
 	}
 
 	void AND::createPhenotypeEnvironment()
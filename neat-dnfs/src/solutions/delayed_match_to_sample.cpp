@@ -1,4 +1,5 @@
 #include "solutions/delayed_match_to_sample.h"
+#include "neat/solution_pool.h"
 
 namespace neat_dnfs
 {
@@ -17,10 +18,7 @@ namespace neat_dnfs
 
 	SolutionPtr DelayedMatchToSample::clone() const
 	{
-		DelayedMatchToSample solution(initialTopology); //, phenotype
-		auto clonedSolution = std::make_shared<DelayedMatchToSample>(solution);
-
-		return clonedSolution;
+		return SolutionPool::make<DelayedMatchToSample>(initialTopology);
 	}
 
 	SolutionPtr DelayedMatchToSample::copy() const
@@ -34,60 +32,65 @@ namespace neat_dnfs
 	void DelayedMatchToSample::testPhenotype()
 	{
 		using namespace dnf_composer::element;
-		parameters.fitness = 0.0;
+		const FieldHandle nf1 = fieldHandle("nf 1");
+		const FieldHandle nf2 = fieldHandle("nf 2");
 		static constexpr int iterations = SimulationConstants::maxSimulationSteps;
-		parameters.partialFitness.clear();
+
+		static constexpr double wf1 = 0.1f;
+		static constexpr double wf2 = 0.15f;
+		static constexpr double wf3 = 0.1f;
+		static constexpr double wf4 = 0.4f;
+		static constexpr double wf5 = 0.1f;
+		static constexpr double wf6 = 0.15f;
+		declarePartialFitnessWeights({ wf1, wf2, wf3, wf4, wf5, wf6 });
 
 		// sample representation
 		initSimulation();
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
 				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations); // enough to encode the memory of the sample
-		const double f1 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth("nf 1", {50.0}, 15.0, 12.0);
-		const double f2 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth("nf 2", {50.0}, 9.0, 12.0);
-		parameters.partialFitness.push_back(f1);
-		parameters.partialFitness.push_back(f2);
+		recordPartialFitness(justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(nf1, {50.0}, 15.0, 12.0));
+		recordPartialFitness(justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(nf2, {50.0}, 9.0, 12.0));
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		// delay
 		removeGaussianStimuli();
 		runSimulation(iterations);
-		const double f3 = closenessToRestingLevel("nf 1");
-		parameters.partialFitness.push_back(f3);
+		recordPartialFitness(closenessToRestingLevel(nf1));
+		if (!continueEvaluation())
+		{
+			return;
+		}
 		// make sure some kind of self-sustained activation exists within
-		double f4_1 = 0.5 * noBumps("nf 2");
-		double f4_2 = 0.5 * preShapednessAtPosition("nf 2", 50.0); //u_tar: -4.2
+		double f4_1 = 0.5 * noBumps(nf2);
+		double f4_2 = 0.5 * preShapednessAtPosition(nf2, 50.0); //u_tar: -4.2
 		runSimulation(iterations*4);
-		f4_1 += 0.5 * noBumps("nf 2");
-		f4_2 += 0.5 * preShapednessAtPosition("nf 2", 50.0); //u_tar: -4.2
-		const double f4 = 0.2f * f4_1 + 0.8f * f4_2;
-		parameters.partialFitness.push_back(f4);
+		f4_1 += 0.5 * noBumps(nf2);
+		f4_2 += 0.5 * preShapednessAtPosition(nf2, 50.0); //u_tar: -4.2
+		recordPartialFitness(0.2f * f4_1 + 0.8f * f4_2);
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		// test with two samples
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 					dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
 						GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 					dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 					dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 100.0,
 						GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 					dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations);
-		const double f5 = twoBumpsAtPositionWithAmplitudeAndWidth("nf 1", 50, 15, 12,
-																					100, 15, 12);
-		const double f6 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth("nf 2", {50}, 9, 12);
-		parameters.partialFitness.emplace_back(f5);
-		parameters.partialFitness.emplace_back(f6);
-
-		static constexpr double wf1 = 0.1f;
-		static constexpr double wf2 = 0.15f;
-		static constexpr double wf3 = 0.1f;
-		static constexpr double wf4 = 0.4f;
-		static constexpr double wf5 = 0.1f;
-		static constexpr double wf6 = 0.15f;
-
-		parameters.fitness = wf1 * f1 + wf2 * f2 + wf3 * f3 + wf4 * f4 + wf5 * f5 + wf6 * f6;
+		recordPartialFitness(twoBumpsAtPositionWithAmplitudeAndWidth(nf1, 50, 15, 12,
+																					100, 15, 12));
+		recordPartialFitness(justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(nf2, {50}, 9, 12));
 	}
 
 	void DelayedMatchToSample::createPhenotypeEnvironment()
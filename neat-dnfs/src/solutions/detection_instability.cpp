@@ -1,4 +1,5 @@
 #include "solutions/detection_instability.h"
+#include "neat/solution_pool.h"
 
 namespace neat_dnfs
 {
@@ -17,10 +18,7 @@ namespace neat_dnfs
 
 	SolutionPtr DetectionInstability::clone() const
 	{
-		DetectionInstability solution(initialTopology);
-		auto clonedSolution = std::make_shared<DetectionInstability>(solution);
-
-		return clonedSolution;
+		return SolutionPool::make<DetectionInstability>(initialTopology);
 	}
 
 	SolutionPtr DetectionInstability::copy() const
@@ -34,40 +32,43 @@ namespace neat_dnfs
 	void DetectionInstability::testPhenotype()
 	{
 		using namespace dnf_composer::element;
-		parameters.fitness = 0.0;
+		const FieldHandle nf1 = fieldHandle("nf 1");
+		const FieldHandle nf2 = fieldHandle("nf 2");
 		static constexpr int iterations = SimulationConstants::maxSimulationSteps;
-		parameters.partialFitness.clear();
+
+		// f1 only one bump at the input field
+		// f2 only one bump at the output field
+		// f3 closeness to resting level after removing the stimulus
+		// f4 closeness to resting level after removing the stimulus
+		static constexpr double wf1 = 1 / 4.f;
+		static constexpr double wf2 = 1 / 4.f;
+		static constexpr double wf3 = 1 / 4.f;
+		static constexpr double wf4 = 1 / 4.f;
+		declarePartialFitnessWeights({ wf1, wf2, wf3, wf4 });
 
 		initSimulation();
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 					dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude,
 						50.0, true, false },
 					dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations);
 
-		const double f1 = oneBumpAtPositionWithAmplitudeAndWidth("nf 1", 50.0, 20, 10);
-		const double f2 = oneBumpAtPositionWithAmplitudeAndWidth("nf 2", 50.0, 15, 5);
-		parameters.partialFitness.emplace_back(f1);
-		parameters.partialFitness.emplace_back(f2);
+		const double f1 = oneBumpAtPositionWithAmplitudeAndWidth(nf1, 50.0, 20, 10);
+		const double f2 = oneBumpAtPositionWithAmplitudeAndWidth(nf2, 50.0, 15, 5);
+		recordPartialFitness(f1);
+		recordPartialFitness(f2);
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		removeGaussianStimuli();
 		runSimulation(iterations*2);
 
-		const double f3 = closenessToRestingLevel("nf 1");
-		const double f4 = closenessToRestingLevel("nf 2");
-		parameters.partialFitness.emplace_back(f3);
-		parameters.partialFitness.emplace_back(f4);
-
-		// f1 only one bump at the input field
-		// f2 only one bump at the output field
-		// f3 closeness to resting level after removing the stimulus
-		// f4 closeness to resting level after removing the stimulus
-		static constexpr double wf1 = 1 / 4.f;
-		static constexpr double wf2 = 1 / 4.f;
-		static constexpr double wf3 = 1 / 4.f;
-		static constexpr double wf4 = 1 / 4.f;
-
-		parameters.fitness = wf1*f1 + wf2*f2 + wf3*f3 + wf4*f4;
+		const double f3 = closenessToRestingLevel(nf1);
+		const double f4 = closenessToRestingLevel(nf2);
+		recordPartialFitness(f3);
+		recordPartialFitness(f4);
 	}
 
 	void DetectionInstability::createPhenotypeEnvironment()
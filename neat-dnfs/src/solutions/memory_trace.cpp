@@ -1,4 +1,5 @@
 #include "solutions/memory_trace.h"
+#include "neat/solution_pool.h"
 
 
 namespace neat_dnfs
@@ -17,10 +18,7 @@ namespace neat_dnfs
 
 	SolutionPtr MemoryTrace::clone() const
 	{
-		MemoryTrace solution(initialTopology);
-		auto clonedSolution = std::make_shared<MemoryTrace>(solution);
-
-		return clonedSolution;
+		return SolutionPool::make<MemoryTrace>(initialTopology);
 	}
 
 	SolutionPtr MemoryTrace::copy() const
@@ -34,10 +32,21 @@ namespace neat_dnfs
 	void MemoryTrace::testPhenotype()
 	{
 		using namespace dnf_composer::element;
-	    parameters.fitness = 0.0;
-	    parameters.partialFitness.clear();
+		const FieldHandle nf1 = fieldHandle("nf 1");
+		const FieldHandle nf2 = fieldHandle("nf 2");
+		const FieldHandle nf3 = fieldHandle("nf 3");
 		static constexpr int iterations = SimulationConstants::maxSimulationSteps;
 
+		static constexpr double wf1 =  1 / 8.f;
+		static constexpr double wf2 =  1 / 8.f;
+		static constexpr double wf5 =  1 / 8.f;
+		static constexpr double wf6 =  1 / 8.f;
+		static constexpr double wf7 =  1 / 8.f;
+		static constexpr double wf8 =  1 / 8.f;
+		static constexpr double wf9 =  1 / 8.f;
+		static constexpr double wf10 = 1 / 8.f;
+		declarePartialFitnessWeights({ wf1, wf2, wf5, wf6, wf7, wf8, wf9, wf10 });
+
 		static constexpr double posA = 20.0;
 		static constexpr double posB = 80.0;
 
@@ -45,66 +54,63 @@ namespace neat_dnfs
 		// Phase A: No encoding, no output bump
 		// =========================
 		initSimulation();
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, posA,
 				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations);
-		const double f1 = preShapednessAtPosition("nf 3", posA);
-		parameters.partialFitness.push_back(f1);
+		recordPartialFitness(preShapednessAtPosition(nf3, posA));
 		removeGaussianStimuli();
 		runSimulation(iterations);
-		const double f2 = closenessToRestingLevel("nf 1");
-		parameters.partialFitness.push_back(f2);
+		recordPartialFitness(closenessToRestingLevel(nf1));
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		// =========================
 		// Phase B: Encoding
 		// =========================
-		addGaussianStimulus("nf 2",
+		addGaussianStimulus(nf2,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, posB,
 				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations*5);
-		const double f5 = preShapednessAtPosition("nf 3", posB);
-		parameters.partialFitness.push_back(f5);
+		recordPartialFitness(preShapednessAtPosition(nf3, posB));
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		// =========================
 		// Phase C: Probing
 		// =========================
 		removeGaussianStimuli();
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, posA,
 				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, posB,
 				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations);
-		const double f6 = closenessToRestingLevel("nf 2");
-		parameters.partialFitness.push_back(f6);
-		const double f7 = twoBumpsAtPositionWithAmplitudeAndWidth("nf 1", posA, 10.0, 10.0, posB, 10.0, 10.0);
-		parameters.partialFitness.push_back(f7);
-		const double f8 = oneBumpAtPositionWithAmplitudeAndWidth("nf 3", posB, 10.0, 10.0);
-		parameters.partialFitness.push_back(f8);
+		recordPartialFitness(closenessToRestingLevel(nf2));
+		recordPartialFitness(twoBumpsAtPositionWithAmplitudeAndWidth(nf1, posA, 10.0, 10.0, posB, 10.0, 10.0));
+		recordPartialFitness(oneBumpAtPositionWithAmplitudeAndWidth(nf3, posB, 10.0, 10.0));
+		if (!continueEvaluation())
+		{
+			return;
+		}
 		runSimulation(iterations);
-		const double f9 = oneBumpAtPositionWithAmplitudeAndWidth("nf 3", posB, 10.0, 10.0);
-		parameters.partialFitness.push_back(f9);
+		recordPartialFitness(oneBumpAtPositionWithAmplitudeAndWidth(nf3, posB, 10.0, 10.0));
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		runSimulation(iterations*2);
-		const double f10 = noBumps("nf 3");
-		parameters.partialFitness.push_back(f10);
-
-		static constexpr double wf1 =  1 / 8.f;
-		static constexpr double wf2 =  1 / 8.f;
-		static constexpr double wf5 =  1 / 8.f;
-		static constexpr double wf6 =  1 / 8.f;
-		static constexpr double wf7 =  1 / 8.f;
-		static constexpr double wf8 =  1 / 8.f;
-		static constexpr double wf9 =  1 / 8.f;
-		static constexpr double wf10 = 1 / 8.f;
-
-		parameters.fitness = wf1 * f1 + wf2 * f2 + wf5 * f5 + wf6 * f6 + wf7 * f7 + wf8 * f8 + wf9 * f9 + wf10 * f10;
+		recordPartialFitness(noBumps(nf3));
 	}
 
 	void MemoryTrace::createPhenotypeEnvironment()
@@ -1,4 +1,5 @@
 #include "solutions/selection_instability.h"
+#include "neat/solution_pool.h"
 
 namespace neat_dnfs
 {
@@ -17,10 +18,7 @@ namespace neat_dnfs
 
 	SolutionPtr SelectionInstability::clone() const
 	{
-		SelectionInstability solution(initialTopology);
-		auto clonedSolution = std::make_shared<SelectionInstability>(solution);
-
-		return clonedSolution;
+		return SolutionPool::make<SelectionInstability>(initialTopology);
 	}
 
 	SolutionPtr SelectionInstability::copy() const
@@ -34,46 +32,49 @@ namespace neat_dnfs
 	void SelectionInstability::testPhenotype()
 	{
 		using namespace dnf_composer::element;
-		parameters.fitness = 0.0;
-		parameters.partialFitness.clear();
+		const FieldHandle nf1 = fieldHandle("nf 1");
+		const FieldHandle nf2 = fieldHandle("nf 2");
 		static constexpr int iterations = SimulationConstants::maxSimulationSteps;
 
+		static constexpr double wf1 = 1 / 4.f;
+		static constexpr double wf2 = 1 / 4.f;
+		static constexpr double wf3 = 1 / 4.f;
+		static constexpr double wf4 = 1 / 4.f;
+		declarePartialFitnessWeights({ wf1, wf2, wf3, wf4 });
+
 		static constexpr double in_amp = 8.0;
 		static constexpr double in_width = 10.0;
 		static constexpr double out_amp = 6.0;
 		static constexpr double out_width = 5.0;
 
 		initSimulation();
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 20.0, true, false },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		addGaussianStimulus("nf 1",
+		addGaussianStimulus(nf1,
 			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 80.0, true, false },
 			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 		runSimulation(iterations);
 
-		const double f1 = twoBumpsAtPositionWithAmplitudeAndWidth("nf 1",
+		const double f1 = twoBumpsAtPositionWithAmplitudeAndWidth(nf1,
 			20.0, in_amp, in_width,
 			80.0, in_amp, in_width);
-		parameters.partialFitness.emplace_back(f1);
-		const double f2 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth("nf 2",
+		recordPartialFitness(f1);
+		const double f2 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(nf2,
 			{ 20.0, 80.0 }, out_amp, out_width);
-		parameters.partialFitness.emplace_back(f2);
+		recordPartialFitness(f2);
+		if (!continueEvaluation())
+		{
+			return;
+		}
 
 		removeGaussianStimuli();
 		runSimulation(iterations);
 
-		const double f3 = closenessToRestingLevel("nf 1");
-		const double f4 = closenessToRestingLevel("nf 2");
-		parameters.partialFitness.emplace_back(f3);
-		parameters.partialFitness.emplace_back(f4);
-
-		static constexpr double wf1 = 1 / 4.f;
-		static constexpr double wf2 = 1 / 4.f;
-		static constexpr double wf3 = 1 / 4.f;
-		static constexpr double wf4 = 1 / 4.f;
-
-		parameters.fitness = wf1*f1 + wf2*f2 + wf3*f3 + wf4*f4;
+		const double f3 = closenessToRestingLevel(nf1);
+		const double f4 = closenessToRestingLevel(nf2);
+		recordPartialFitness(f3);
+		recordPartialFitness(f4);
 	}
 
 	void SelectionInstability::createPhenotypeEnvironment()
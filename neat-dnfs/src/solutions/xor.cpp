@@ -1,4 +1,5 @@
 #include "solutions/xor.h"
+#include "neat/solution_pool.h"
 
 namespace neat_dnfs
 {
@@ -16,10 +17,7 @@ namespace neat_dnfs
 
 	SolutionPtr XOR::clone() const
 	{
-		XOR solution(initialTopology, phenotype);
-		auto clonedSolution = std::make_shared<XOR>(solution);
-
-		return clonedSolution;
+		return SolutionPool::make<XOR>(initialTopology);
 	}
 
 	SolutionPtr XOR::copy() const
@@ -33,62 +31,48 @@ namespace neat_dnfs
 	void XOR::testPhenotype()
 	{
 		using namespace dnf_composer::element;
-		parameters.fitness = 0.0;
-		parameters.partialFitness.clear();
+		const FieldHandle nf1 = fieldHandle("nf 1");
+		const FieldHandle nf2 = fieldHandle("nf 2");
+		const FieldHandle nf3 = fieldHandle("nf 3");
 
-		static constexpr int iterations = SimulationConstants::maxSimulationSteps;
-
-		static constexpr double in_amp = 10.0;
-		static constexpr double in_width = 12.0;
 		static constexpr double out_amp = 5.0;
 		static constexpr double out_width = 9.0;
 
-		initSimulation();
-		addGaussianStimulus("nf 1",
-			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
-			GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
-dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		runSimulation(iterations);
-		const double f1 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth("nf 3", { 50.0 }, out_amp, out_width);
-		parameters.partialFitness.push_back(f1);
-		removeGaussianStimuli();
-
-		removeGaussianStimuli();
-		initSimulation();
-		addGaussianStimulus("nf 2",
-			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
-			GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
-			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		runSimulation(iterations);
-		const double f2 = justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth("nf 3", { 50.0 }, out_amp, out_width);
-		parameters.partialFitness.push_back(f2);
-
-		removeGaussianStimuli();
-		initSimulation();
-		addGaussianStimulus("nf 1",
-			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
-			GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
-			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		addGaussianStimulus("nf 2",
-			dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
-				GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
-			dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
-		runSimulation(iterations);
-		const double f3 = noBumps("nf 3");
-		parameters.partialFitness.push_back(f3);
-
-		removeGaussianStimuli();
-		runSimulation(iterations);
-		const double f4 = closenessToRestingLevel("nf 3");
-		parameters.partialFitness.push_back(f4);
-
 		static constexpr double wf1 = 1 / 4.f;
 		static constexpr double wf2 = 1 / 4.f;
 		static constexpr double wf3 = 1 / 4.f;
 		static constexpr double wf4 = 1 / 4.f;
-
-
-		parameters.fitness = wf1 * f1 + wf2 * f2 + wf3 * f3 + wf4 * f4;
+		declarePartialFitnessWeights({ wf1, wf2, wf3, wf4 });
+
+		const GaussStimulusParameters input{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
+			GaussStimulusConstants::circularity, GaussStimulusConstants::normalization };
+		const auto oneBumpAtCentre = [nf3](const TrialSnapshots& fields) -> std::vector<double>
+			{
+				return { justOneBumpAtOneOfTheFollowingPositionsWithAmplitudeAndWidth(fields[nf3], { 50.0 }, out_amp, out_width) };
+			};
+
+		// The three input conditions each start from rest; the last one then
+		// watches the output relax once its inputs are removed.
+		const std::vector<Trial> trials{
+			{ { .stimuli = { { nf1, input } }, .score = oneBumpAtCentre } },
+			{ { .stimuli = { { nf2, input } }, .score = oneBumpAtCentre } },
+			{
+				{ .stimuli = { { nf1, input }, { nf2, input } },
+					.score = [nf3](const TrialSnapshots& fields) -> std::vector<double> { return { noBumps(fields[nf3]) }; } },
+				{ .score = [nf3](const TrialSnapshots& fields) -> std::vector<double> { return { closenessToRestingLevel(fields[nf3]) }; } },
+			},
+		};
+		for (size_t i = 0; i < trials.size(); ++i)
+		{
+			for (const double term : runTrials({ trials[i] }))
+			{
+				recordPartialFitness(term);
+			}
+			if (i + 1 < trials.size() && !continueEvaluation())
+			{
+				return;
+			}
+		}
 	}
 
 	void XOR::createPhenotypeEnvironment()
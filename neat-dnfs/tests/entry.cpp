@@ -7,7 +7,7 @@
 
 // dnf_composer's logger writes to shared global output without synchronisation.
 // Parallel solution evaluation (PopulationParameters::parallelEvolution) emits many
-// INFO logs concurrently from std::async threads, which races and crashes. Production
+// INFO logs concurrently from thread pool workers, which races and crashes. Production
 // examples already raise the level to ERROR; tests do the same so they can exercise the
 // parallel path safely. Remove once dnf_composer's logger is made thread-safe.
 //
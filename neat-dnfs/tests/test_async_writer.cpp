@@ -0,0 +1,47 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#include "neat_tools/async_writer.h"
+
+using namespace neat_dnfs;
+
+TEST_CASE("AsyncWriter runs jobs in submission order", "[AsyncWriter]")
+{
+    tools::AsyncWriter writer;
+    std::vector<int> order; // only touched by the writer thread until flush()
+
+    for (int i = 0; i < 100; ++i)
+        writer.enqueue([&order, i]() { order.push_back(i); });
+    writer.flush();
+
+    REQUIRE(order.size() == 100);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(order[i] == i);
+}
+
+TEST_CASE("AsyncWriter::flush rethrows the first job failure once", "[AsyncWriter]")
+{
+    tools::AsyncWriter writer;
+    int ran = 0;
+
+    writer.enqueue([]() { throw std::runtime_error("disk full"); });
+    writer.enqueue([]() { throw std::logic_error("second failure"); });
+    writer.enqueue([&ran]() { ++ran; });
+
+    REQUIRE_THROWS_AS(writer.flush(), std::runtime_error);
+    REQUIRE(ran == 1); // later jobs still ran
+    REQUIRE_NOTHROW(writer.flush());
+}
+
+TEST_CASE("AsyncWriter destructor finishes queued jobs", "[AsyncWriter]")
+{
+    int ran = 0;
+    {
+        tools::AsyncWriter writer;
+        for (int i = 0; i < 10; ++i)
+            writer.enqueue([&ran]() { ++ran; });
+    }
+    REQUIRE(ran == 10);
+}
@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "neat/population.h"
+#include "neat_tools/binary_io.h"
+#include "neat_tools/noise_tape.h"
+#include "test_helpers.h"
+#include "test_stub_solution.h"
+
+using namespace neat_dnfs;
+using namespace neat_dnfs::test;
+
+namespace
+{
+    // Serial evaluation keeps every random draw on this thread's engine, which
+    // is the one the checkpoint captures; CountingSolution's fitness is a pure
+    // function of the genome.
+    PopulationParameters checkpointParameters(const int numGenerations)
+    {
+        PopulationParameters parameters(10, numGenerations, 1e9, false);
+        return parameters;
+    }
+
+    std::vector<std::uint64_t> genomeHashes(const Population& population)
+    {
+        std::vector<std::uint64_t> hashes;
+        for (const auto& solution : population.getSolutions())
+            hashes.push_back(solution->getGenome().contentHash());
+        return hashes;
+    }
+
+    std::vector<int> solutionIds(const Population& population)
+    {
+        std::vector<int> ids;
+        for (const auto& solution : population.getSolutions())
+            ids.push_back(solution->getId());
+        return ids;
+    }
+}
+
+TEST_CASE("BinaryReader reads back what BinaryWriter wrote", "[Checkpoint]")
+{
+    std::stringstream stream;
+    tools::BinaryWriter writer(stream);
+    writer.write(42);
+    writer.write(-0.25);
+    writer.writeString("fg (id: 1)");
+    writer.writeVector(std::vector<double>{ 1.0, 2.0, 3.0 });
+
+    tools::BinaryReader reader(stream);
+    REQUIRE(reader.read<int>() == 42);
+    REQUIRE(reader.read<double>() == -0.25);
+    REQUIRE(reader.readString() == "fg (id: 1)");
+    REQUIRE(reader.readVector<double>() == std::vector<double>{ 1.0, 2.0, 3.0 });
+    REQUIRE_THROWS_AS(reader.read<int>(), std::runtime_error);
+}
+
+TEST_CASE("Genome::serialize round-trips every gene", "[Checkpoint]")
+{
+    resetGlobalState();
+    Genome genome;
+    genome.addInputGene({ 100, 1.0 });
+    genome.addOutputGene({ 100, 1.0 });
+    for (int i = 0; i < 20; ++i)
+        genome.mutate();
+
+    std::stringstream stream;
+    tools::BinaryWriter writer(stream);
+    genome.serialize(writer);
+
+    Genome restored;
+    tools::BinaryReader reader(stream);
+    restored.deserialize(reader);
+
+    REQUIRE(restored.contentHash() == genome.contentHash());
+    REQUIRE(restored.getInnovationNumbers() == genome.getInnovationNumbers());
+    REQUIRE(restored.getMutationsInLastGeneration() == genome.getMutationsInLastGeneration());
+    REQUIRE(restored.compatibilityTerms(genome).averageConnectionDifference == 0.0);
+    for (size_t i = 0; i < genome.getFieldGenes().size(); ++i)
+        REQUIRE(restored.getFieldGenes()[i].isCloneOf(genome.getFieldGenes()[i]));
+    for (size_t i = 0; i < genome.getConnectionGenes().size(); ++i)
+        REQUIRE(restored.getConnectionGenes()[i].isCloneOf(genome.getConnectionGenes()[i]));
+}
+
+TEST_CASE("Solution::deserialize drops the previous run's noise tape", "[Checkpoint]")
+{
+    resetGlobalState();
+    CountingSolution original(makeTopology(1, 1));
+    original.initialize();
+
+    std::stringstream stream;
+    tools::BinaryWriter writer(stream);
+    original.serialize(writer);
+
+    CountingSolution restored(makeTopology(1, 1));
+    restored.setNoiseTape(std::make_shared<const tools::NoiseTape>(16, DimensionConstants::xSize, 3));
+    tools::BinaryReader reader(stream);
+    restored.deserialize(reader);
+
+    REQUIRE(restored.getNoiseTape() == nullptr);
+    REQUIRE(restored.getId() == original.getId());
+}
+
+TEST_CASE("A population resumed from a checkpoint continues the original run", "[Checkpoint]")
+{
+    resetGlobalState();
+    const auto initialSolution = std::make_shared<CountingSolution>(makeTopology(1, 1));
+
+    Population original(checkpointParameters(3), initialSolution, false);
+    original.initialize();
+    original.evolve();
+    REQUIRE(original.getCurrentGeneration() == 3);
+
+    std::stringstream checkpoint;
+    original.writeCheckpoint(checkpoint);
+
+    original.setNumGenerations(6);
+    original.evolve();
+
+    Population resumed(checkpointParameters(6), initialSolution, false);
+    resumed.readCheckpoint(checkpoint);
+    REQUIRE(resumed.getCurrentGeneration() == 3);
+    resumed.evolve();
+
+    REQUIRE(resumed.getCurrentGeneration() == original.getCurrentGeneration());
+    REQUIRE(resumed.getBestFitnessHistory() == original.getBestFitnessHistory());
+    REQUIRE(resumed.getBestSolutionIdHistory() == original.getBestSolutionIdHistory());
+    REQUIRE(solutionIds(resumed) == solutionIds(original));
+    REQUIRE(genomeHashes(resumed) == genomeHashes(original));
+    REQUIRE(resumed.getSpeciesList().size() == original.getSpeciesList().size());
+}
+
+TEST_CASE("Population::readCheckpoint rejects corrupt checkpoints without changing the population", "[Checkpoint]")
+{
+    resetGlobalState();
+    const auto initialSolution = std::make_shared<CountingSolution>(makeTopology(1, 1));
+    Population population(checkpointParameters(2), initialSolution, false);
+    population.initialize();
+    population.evolve();
+
+    std::stringstream checkpoint;
+    population.writeCheckpoint(checkpoint);
+    const std::string bytes = checkpoint.str();
+
+    Population target(checkpointParameters(2), initialSolution, false);
+    target.initialize();
+    const auto before = genomeHashes(target);
+
+    SECTION("truncated")
+    {
+        std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+        REQUIRE_THROWS_AS(target.readCheckpoint(truncated), std::runtime_error);
+    }
+    SECTION("not a checkpoint")
+    {
+        std::stringstream garbage(std::string(bytes.size(), 'x'));
+        REQUIRE_THROWS_AS(target.readCheckpoint(garbage), std::runtime_error);
+    }
+    SECTION("different population size")
+    {
+        Population larger(PopulationParameters(12, 2, 1e9, false), initialSolution, false);
+        std::stringstream copy(bytes);
+        REQUIRE_THROWS_AS(larger.readCheckpoint(copy), std::runtime_error);
+    }
+    SECTION("different task")
+    {
+        Population other(checkpointParameters(2), std::make_shared<FixedFitnessSolution>(makeTopology(1, 1), 0.5), false);
+        std::stringstream copy(bytes);
+        REQUIRE_THROWS_AS(other.readCheckpoint(copy), std::runtime_error);
+    }
+
+    REQUIRE(genomeHashes(target) == before);
+    REQUIRE(target.getCurrentGeneration() == 0);
+}
@@ -172,6 +172,24 @@ TEST_CASE("ConnectionGene::clone preserves parameters and innovation number", "[
     REQUIRE(cloned.getKernel() != connectionGene.getKernel());
 }
 
+TEST_CASE("ConnectionGene builds its coupling kernel from its parameters", "[ConnectionGene]")
+{
+    const GaussKernelParameters gkp{ 5.0, 3.0, false, false };
+    const ConnectionGene connectionGene(ConnectionTuple(1, 2), 7, gkp);
+
+    const auto kernel = std::dynamic_pointer_cast<GaussKernel>(connectionGene.getKernel());
+    REQUIRE(kernel != nullptr);
+    REQUIRE(kernel->getUniqueName() == connectionGene.getKernelName());
+    REQUIRE(kernel->getParameters().width == connectionGene.getKernelWidth());
+    REQUIRE(kernel->getParameters().amplitude == connectionGene.getKernelAmplitude());
+
+    ConnectionGene copy = connectionGene;
+    for (int i = 0; i < 50; ++i)
+        copy.mutate();
+    REQUIRE(connectionGene.getKernelWidth() == 5.0);
+    REQUIRE(connectionGene.getKernelAmplitude() == 3.0);
+}
+
 TEST_CASE("ConnectionGene::clearLastMutations empties getMutationsInLastGeneration", "[ConnectionGene]")
 {
     const ConnectionTuple connectionTuple(1, 2);
@@ -1,4 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+
 #include "neat/field_gene.h"
 
 using namespace neat_dnfs;
@@ -140,6 +143,39 @@ TEST_CASE("FieldGene::clone produces an independent deep copy", "[FieldGene]")
     REQUIRE(cloned.getNeuralField() != fieldGene.getNeuralField());
 }
 
+TEST_CASE("FieldGene copies do not share parameters with the original", "[FieldGene]")
+{
+    const FieldGeneParameters params(FieldGeneType::HIDDEN, 12);
+    const FieldGene fieldGene(params);
+    const double tau = fieldGene.getNeuralFieldParameters().tau;
+
+    FieldGene copy = fieldGene;
+    for (int i = 0; i < 50; ++i)
+        copy.mutate();
+
+    REQUIRE(fieldGene.getNeuralFieldParameters().tau == tau);
+    REQUIRE(fieldGene.getMutationsInLastGeneration().empty());
+    REQUIRE(fieldGene.isCloneOf(fieldGene.clone()));
+}
+
+TEST_CASE("FieldGene builds elements from its parameters", "[FieldGene]")
+{
+    const FieldGeneParameters params(FieldGeneType::HIDDEN, 13);
+    const FieldGene fieldGene(params);
+
+    const auto neuralField = fieldGene.getNeuralField();
+    REQUIRE(neuralField->getUniqueName() == fieldGene.getNeuralFieldName());
+    REQUIRE(neuralField->getParameters().tau == fieldGene.getNeuralFieldParameters().tau);
+
+    const auto kernel = fieldGene.getKernel();
+    REQUIRE(kernel->getUniqueName() == fieldGene.getKernelName());
+    REQUIRE(kernel->getLabel() == fieldGene.getKernelLabel());
+    REQUIRE(sameKernelParameters(kernelParametersOf(kernel), fieldGene.getKernelParameters()));
+
+    // Each call builds a new element.
+    REQUIRE(fieldGene.getKernel() != kernel);
+}
+
 TEST_CASE("FieldGene::clearLastMutations empties getMutationsInLastGeneration", "[FieldGene]")
 {
     FieldGeneParameters params(FieldGeneType::HIDDEN, 8);
@@ -185,3 +221,27 @@ TEST_CASE("FieldGene Kernel Parameters Access", "[FieldGene]")
         REQUIRE(mhKernel != nullptr);
     }
 }
+
+TEST_CASE("FieldGene::getNoise reads a noise tape on the gene's lane", "[FieldGene]")
+{
+    const FieldGene fieldGene(FieldGeneParameters(FieldGeneType::HIDDEN, 13));
+    const auto tape = std::make_shared<const tools::NoiseTape>(16, DimensionConstants::xSize, 3);
+
+    REQUIRE(std::dynamic_pointer_cast<TapeNoise>(fieldGene.getNoise(nullptr)) == nullptr);
+
+    const auto noise = std::dynamic_pointer_cast<TapeNoise>(fieldGene.getNoise(tape));
+    REQUIRE(noise != nullptr);
+    REQUIRE(noise->getUniqueName() == fieldGene.getNoiseName());
+    REQUIRE(noise->getLane() == 13);
+
+    noise->init();
+    noise->step(0.0, 1.0);
+    noise->step(1.0, 1.0);
+    const auto& output = noise->getComponent("output");
+    const auto draws = tape->row(1, 13);
+    for (size_t x = 0; x < output.size(); ++x)
+        REQUIRE(output[x] == fieldGene.getNoiseParameters().amplitude * draws[x]);
+
+    // A clone keeps reading the tape.
+    REQUIRE(std::dynamic_pointer_cast<TapeNoise>(noise->clone()) != nullptr);
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "neat/field_gene.h"
+#include "neat/field_snapshot.h"
+
+using namespace neat_dnfs;
+
+TEST_CASE("FieldSnapshot computes its statistics and bumps in one take", "[FieldSnapshot]")
+{
+    std::vector<double> activation(10, -4.0);
+    activation[2] = 1.0;
+    activation[3] = 3.0;
+    activation[7] = 0.5;
+
+    FieldSnapshot snapshot;
+    snapshot.take(activation, 2.0, -5.0);
+
+    REQUIRE(snapshot.activation == activation);
+    REQUIRE(snapshot.restingLevel == -5.0);
+    REQUIRE(snapshot.highestActivation == 3.0);
+    REQUIRE(snapshot.highestActivationIndex == 3);
+    REQUIRE(snapshot.highestActivationPosition() == Catch::Approx(6.0));
+    REQUIRE(snapshot.lowestActivation == -4.0);
+    REQUIRE(snapshot.meanActivation == Catch::Approx((4.5 - 7 * 4.0) / 10.0));
+
+    REQUIRE(snapshot.hasBumps());
+    REQUIRE(snapshot.bumps.size() == 2);
+    REQUIRE(snapshot.bumps[0].startPosition == Catch::Approx(4.0));
+    REQUIRE(snapshot.bumps[0].endPosition == Catch::Approx(6.0));
+    REQUIRE(snapshot.bumps[0].centroid == Catch::Approx(5.0));
+    REQUIRE(snapshot.bumps[0].width == Catch::Approx(4.0));
+    REQUIRE(snapshot.bumps[0].amplitude == Catch::Approx(3.0));
+    REQUIRE(snapshot.bumps[1].centroid == Catch::Approx(14.0));
+    REQUIRE(snapshot.bumps[1].width == Catch::Approx(2.0));
+    REQUIRE(snapshot.bumps[1].amplitude == Catch::Approx(0.5));
+}
+
+TEST_CASE("FieldSnapshot clamps positions to the field", "[FieldSnapshot]")
+{
+    std::vector<double> activation(10);
+    for (size_t x = 0; x < activation.size(); ++x)
+        activation[x] = static_cast<double>(x);
+
+    FieldSnapshot snapshot;
+    snapshot.take(activation, 1.0, 0.0);
+    REQUIRE(snapshot.activationAt(4.5) == 4.0);
+    REQUIRE(snapshot.activationAt(-3.0) == 0.0);
+    REQUIRE(snapshot.activationAt(10.0) == 9.0);
+    REQUIRE(snapshot.activationAt(250.0) == 9.0);
+}
+
+TEST_CASE("FieldSnapshot retakes replace every value", "[FieldSnapshot]")
+{
+    std::vector<double> activation(20, 1.0);
+    FieldSnapshot snapshot;
+    snapshot.take(activation, 1.0, -5.0);
+    REQUIRE(snapshot.bumps.size() == 1);
+    REQUIRE(snapshot.bumps.front().width == Catch::Approx(20.0));
+
+    std::ranges::fill(activation, -5.0);
+    snapshot.take(activation, 1.0, -5.0);
+    REQUIRE_FALSE(snapshot.hasBumps());
+    REQUIRE(snapshot.highestActivation == -5.0);
+    REQUIRE(snapshot.highestActivationIndex == 0);
+
+    REQUIRE_THROWS_AS(snapshot.take({}, 1.0, -5.0), std::invalid_argument);
+}
+
+TEST_CASE("FieldSnapshot merges a bump straddling the edge of the circular field", "[FieldSnapshot]")
+{
+    std::vector<double> activation(10, -4.0);
+    activation[8] = 1.0;
+    activation[9] = 2.0;
+    activation[0] = 4.0;
+    activation[4] = 0.5;
+
+    FieldSnapshot snapshot;
+    snapshot.take(activation, 2.0, -5.0);
+
+    REQUIRE(snapshot.bumps.size() == 2);
+    REQUIRE(snapshot.bumps[0].centroid == Catch::Approx(8.0));
+    const auto& wrapped = snapshot.bumps[1];
+    REQUIRE(wrapped.startPosition == Catch::Approx(16.0));
+    REQUIRE(wrapped.endPosition == Catch::Approx(0.0));
+    REQUIRE(wrapped.width == Catch::Approx(6.0));
+    REQUIRE(wrapped.centroid == Catch::Approx(18.0));
+    REQUIRE(wrapped.amplitude == Catch::Approx(4.0));
+
+    // A field entirely above threshold is one bump, not merged with itself.
+    std::ranges::fill(activation, 1.0);
+    snapshot.take(activation, 1.0, -5.0);
+    REQUIRE(snapshot.bumps.size() == 1);
+    REQUIRE(snapshot.bumps.front().startPosition == Catch::Approx(0.0));
+    REQUIRE(snapshot.bumps.front().endPosition == Catch::Approx(9.0));
+}
+
+TEST_CASE("findBumps matches NeuralField::getBumps() for a bump across x = 0", "[FieldSnapshot]")
+{
+    using namespace dnf_composer::element;
+
+    const FieldGene gene(FieldGeneParameters(FieldGeneType::OUTPUT, 1));
+    const auto field = gene.getNeuralField();
+    const ElementDimensions dimensions{ DimensionConstants::xSize, DimensionConstants::dx };
+    const auto stimulus = std::make_shared<GaussStimulus>(GaussStimulus{ { "gs straddling", dimensions },
+        GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 0.0,
+            true, GaussStimulusConstants::normalization } });
+
+    dnf_composer::Simulation simulation("straddling bump", SimulationConstants::deltaT);
+    simulation.addElement(field);
+    simulation.addElement(stimulus);
+    simulation.createInteraction(stimulus->getUniqueName(), "output", field->getUniqueName());
+    simulation.init();
+    for (int step = 0; step < 200; ++step)
+        simulation.step();
+
+    const auto expected = field->getBumps();
+    const auto actual = findBumps(field->getComponent("activation"), DimensionConstants::dx);
+    REQUIRE(expected.size() == 1);
+    REQUIRE(actual.size() == expected.size());
+    const double dx = DimensionConstants::dx;
+    REQUIRE(actual.front().startPosition == Catch::Approx(expected.front().startPosition).margin(dx));
+    REQUIRE(actual.front().endPosition == Catch::Approx(expected.front().endPosition).margin(dx));
+    REQUIRE(actual.front().centroid == Catch::Approx(expected.front().centroid).margin(dx));
+    REQUIRE(actual.front().width == Catch::Approx(expected.front().width).margin(dx));
+    REQUIRE(actual.front().amplitude == Catch::Approx(expected.front().amplitude).margin(1e-9));
+}
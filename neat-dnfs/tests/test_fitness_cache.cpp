@@ -0,0 +1,245 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <sstream>
+
+#include "neat/fitness_cache.h"
+#include "neat/population.h"
+#include "test_helpers.h"
+#include "test_stub_solution.h"
+
+using namespace neat_dnfs;
+using namespace neat_dnfs::test;
+using namespace dnf_composer::element;
+
+namespace
+{
+    // Solutions with fixed genes, so two of them built from the same ids share a
+    // content hash -- the randomized FieldGene constructor would make every
+    // genome unique and never exercise a cache hit.
+    SolutionPtr makeFixedSolution(const int hiddenId = 0)
+    {
+        auto solution = std::make_shared<CountingSolution>(makeTopology(1, 1));
+        solution->addFieldGene(makeFixedFieldGene(FieldGeneType::INPUT, 1));
+        solution->addFieldGene(makeFixedFieldGene(FieldGeneType::OUTPUT, 2));
+        if (hiddenId > 0)
+            solution->addFieldGene(makeFixedFieldGene(FieldGeneType::HIDDEN, hiddenId));
+        return solution;
+    }
+}
+
+TEST_CASE("Genome::contentHash tracks phenotype-relevant content only", "[FitnessCache]")
+{
+    resetGlobalState();
+    const auto a = makeFixedSolution();
+    const auto b = makeFixedSolution();
+    REQUIRE(a->getGenome().contentHash() == b->getGenome().contentHash());
+
+    const auto c = makeFixedSolution(3);
+    REQUIRE(a->getGenome().contentHash() != c->getGenome().contentHash());
+
+    // Innovation numbers don't shape the phenotype, so they don't enter the hash.
+    a->addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 7, GaussKernelParameters{ 3.0, 5.0, 0.0, true, true }));
+    b->addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 8, GaussKernelParameters{ 3.0, 5.0, 0.0, true, true }));
+    REQUIRE(a->getGenome().contentHash() == b->getGenome().contentHash());
+
+    b->clearGenome();
+    b->addFieldGene(makeFixedFieldGene(FieldGeneType::INPUT, 1));
+    b->addFieldGene(makeFixedFieldGene(FieldGeneType::OUTPUT, 2));
+    b->addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 7, GaussKernelParameters{ 3.5, 5.0, 0.0, true, true }));
+    REQUIRE(a->getGenome().contentHash() != b->getGenome().contentHash());
+}
+
+TEST_CASE("FitnessCache::Reuse restores unchanged genomes without re-evaluating them", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Reuse);
+    const std::vector<SolutionPtr> solutions{ makeFixedSolution(), makeFixedSolution(3) };
+
+    auto pending = cache.restore(solutions);
+    REQUIRE(pending.size() == 2);
+    REQUIRE(cache.getMisses() == 2);
+    pending[0]->setEvaluationResult(0.25, { 0.5 });
+    pending[1]->setEvaluationResult(0.75, { 1.0 });
+    cache.record(pending);
+
+    const auto carriedOver = makeFixedSolution(3);
+    const std::vector<SolutionPtr> nextGeneration{ solutions[0], carriedOver };
+    pending = cache.restore(nextGeneration);
+    REQUIRE(pending.empty());
+    REQUIRE(cache.getHits() == 2);
+    REQUIRE(carriedOver->getFitness() == Catch::Approx(0.75));
+    REQUIRE(carriedOver->getParameters().partialFitness == std::vector<double>{ 1.0 });
+}
+
+TEST_CASE("FitnessCache::Reuse simulates in-generation duplicates once", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Reuse);
+    const std::vector<SolutionPtr> solutions{ makeFixedSolution(), makeFixedSolution() };
+
+    const auto pending = cache.restore(solutions);
+    REQUIRE(pending.size() == 1);
+    REQUIRE(cache.getHits() == 1);
+    pending[0]->setEvaluationResult(0.5, {});
+    cache.record(pending);
+
+    REQUIRE(solutions[1]->getFitness() == Catch::Approx(0.5));
+}
+
+TEST_CASE("FitnessCache::Resample averages N samples before reusing them", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Resample, 3);
+    const std::vector<SolutionPtr> solutions{ makeFixedSolution() };
+
+    for (const double sample : { 0.2, 0.4, 0.9 })
+    {
+        const auto pending = cache.restore(solutions);
+        REQUIRE(pending.size() == 1);
+        pending[0]->setEvaluationResult(sample, {});
+        cache.record(pending);
+    }
+    REQUIRE(solutions[0]->getFitness() == Catch::Approx(0.5));
+
+    solutions[0]->setEvaluationResult(0.0, {});
+    REQUIRE(cache.restore(solutions).empty());
+    REQUIRE(solutions[0]->getFitness() == Catch::Approx(0.5));
+}
+
+TEST_CASE("FitnessCache never reuses a truncated evaluation", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Reuse);
+    const auto solution = std::make_shared<PhasedSolution>(makeTopology(1, 1), std::vector<double>{ 0.0, 1.0, 1.0 });
+    solution->addFieldGene(makeFixedFieldGene(FieldGeneType::INPUT, 1));
+    solution->addFieldGene(makeFixedFieldGene(FieldGeneType::OUTPUT, 2));
+    const std::vector<SolutionPtr> solutions{ solution };
+
+    auto pending = cache.restore(solutions);
+    solution->setEarlyTerminationThreshold(0.9);
+    solution->evaluate();
+    REQUIRE(solution->getParameters().evaluationTruncated);
+    cache.record(pending);
+    REQUIRE(cache.size() == 0);
+
+    pending = cache.restore(solutions);
+    REQUIRE(pending.size() == 1);
+    solution->setEarlyTerminationThreshold(-1.0);
+    solution->evaluate();
+    cache.record(pending);
+    REQUIRE(cache.size() == 1);
+    REQUIRE(solution->getFitness() == Catch::Approx(0.5));
+}
+
+TEST_CASE("FitnessCache marks duplicates of a truncated evaluation as truncated", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Reuse);
+    std::vector<SolutionPtr> solutions;
+    for (int i = 0; i < 2; ++i)
+    {
+        const auto solution = std::make_shared<PhasedSolution>(makeTopology(1, 1), std::vector<double>{ 0.0, 1.0, 1.0 });
+        solution->addFieldGene(makeFixedFieldGene(FieldGeneType::INPUT, 1));
+        solution->addFieldGene(makeFixedFieldGene(FieldGeneType::OUTPUT, 2));
+        solutions.push_back(solution);
+    }
+
+    const auto pending = cache.restore(solutions);
+    REQUIRE(pending.size() == 1);
+    pending[0]->setEarlyTerminationThreshold(0.9);
+    pending[0]->evaluate();
+    REQUIRE(pending[0]->getParameters().evaluationTruncated);
+    cache.record(pending);
+
+    REQUIRE(solutions[1]->getFitness() == Catch::Approx(pending[0]->getFitness()));
+    REQUIRE(solutions[1]->getParameters().evaluationTruncated);
+
+    // Once a full evaluation is recorded, duplicates of it are full too.
+    const auto next = cache.restore(solutions);
+    REQUIRE(next.size() == 1);
+    next[0]->setEarlyTerminationThreshold(-1.0);
+    next[0]->evaluate();
+    cache.record(next);
+    REQUIRE_FALSE(solutions[1]->getParameters().evaluationTruncated);
+    REQUIRE(solutions[1]->getFitness() == Catch::Approx(0.5));
+}
+
+TEST_CASE("FitnessCache drops genomes that left the population", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Reuse);
+
+    auto pending = cache.restore({ makeFixedSolution(), makeFixedSolution(3) });
+    cache.record(pending);
+    REQUIRE(cache.size() == 2);
+
+    pending = cache.restore({ makeFixedSolution(3) });
+    cache.record(pending);
+    REQUIRE(cache.size() == 1);
+}
+
+TEST_CASE("FitnessCache simulates a hash hit whose gene counts differ", "[FitnessCache]")
+{
+    resetGlobalState();
+    const std::vector<SolutionPtr> solutions{ makeFixedSolution() };
+
+    // An entry under this genome's hash, but recorded for a genome with three
+    // field genes: what a contentHash() collision would leave behind.
+    std::stringstream stream;
+    tools::BinaryWriter writer(stream);
+    writer.write(std::uint64_t{ 1 });
+    writer.write(solutions[0]->getGenome().contentHash());
+    writer.write(std::uint64_t{ 3 });
+    writer.write(std::uint64_t{ 0 });
+    writer.write(std::uint64_t{ 0 });
+    writer.write(0.9);
+    writer.writeVector(std::vector<double>{});
+    writer.write(std::int32_t{ 1 });
+
+    FitnessCache cache(FitnessCachePolicy::Reuse);
+    tools::BinaryReader reader(stream);
+    cache.deserialize(reader);
+    REQUIRE(cache.size() == 1);
+
+    auto pending = cache.restore(solutions);
+    REQUIRE(pending.size() == 1);
+    pending[0]->setEvaluationResult(0.25, {});
+    cache.record(pending);
+
+    // The simulated genome took the entry over.
+    pending = cache.restore(solutions);
+    REQUIRE(pending.empty());
+    REQUIRE(solutions[0]->getFitness() == Catch::Approx(0.25));
+}
+
+TEST_CASE("FitnessCache::Disabled always re-evaluates", "[FitnessCache]")
+{
+    resetGlobalState();
+    FitnessCache cache(FitnessCachePolicy::Disabled);
+    const std::vector<SolutionPtr> solutions{ makeFixedSolution(), makeFixedSolution() };
+
+    for (int generation = 0; generation < 2; ++generation)
+    {
+        const auto pending = cache.restore(solutions);
+        REQUIRE(pending.size() == 2);
+        cache.record(pending);
+    }
+    REQUIRE(cache.getHits() == 0);
+}
+
+TEST_CASE("Population reports fitness cache hits and misses per generation", "[FitnessCache]")
+{
+    resetGlobalState();
+    PopulationParameters parameters(20, 3, 1.1); // target > 1.0 forces a full run
+    parameters.fitnessCachePolicy = FitnessCachePolicy::Reuse;
+    Population population(parameters, std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.initialize();
+    population.evolve();
+
+    const auto& statistics = population.getPerGenerationStatistics();
+    REQUIRE(statistics.fitnessCacheHits + statistics.fitnessCacheMisses == population.getSize());
+    // The preserved elite never mutates, so from the second generation on it is
+    // always restored from the cache.
+    REQUIRE(statistics.fitnessCacheHits > 0);
+}
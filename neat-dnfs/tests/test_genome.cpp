@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include <vector>
 #include <algorithm>
@@ -48,6 +49,25 @@ TEST_CASE("Genome::isEmpty is false once any gene is added", "[Genome]")
     REQUIRE_FALSE(genome.isEmpty());
 }
 
+TEST_CASE("Genome::clear removes every gene and its innovation index", "[Genome]")
+{
+    Genome genome;
+    genome.addInputGene(kDim);
+    genome.addOutputGene(kDim);
+    genome.addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 1));
+
+    genome.clear();
+    REQUIRE(genome.isEmpty());
+    REQUIRE(genome.getInnovationNumbers().empty());
+
+    Genome reference;
+    reference.addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 7));
+    genome.addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 7));
+    const auto terms = genome.compatibilityTerms(reference);
+    REQUIRE(terms.excessGenes == 0);
+    REQUIRE(terms.disjointGenes == 0);
+}
+
 TEST_CASE("Add Field Genes", "[Genome]")
 {
     Genome genome;
@@ -439,3 +459,121 @@ TEST_CASE("Genome::mutate over many iterations always produces valid gene ids",
         }
     }
 }
+
+namespace
+{
+    // The compatibility terms computed the pre-index way, straight from
+    // getConnectionGenes(), as a reference for Genome::compatibilityTerms.
+    CompatibilityTerms referenceCompatibilityTerms(const Genome& a, const Genome& b)
+    {
+        CompatibilityTerms terms;
+        const auto& genesA = a.getConnectionGenes();
+        const auto& genesB = b.getConnectionGenes();
+        if (genesA.empty() && genesB.empty())
+            return terms;
+
+        const auto maxInnovation = [](const std::vector<ConnectionGene>& genes)
+        {
+            int max = 0;
+            for (const auto& gene : genes)
+                max = std::max(max, gene.getInnovationNumber());
+            return genes.empty() ? 0 : max;
+        };
+        const int maxA = maxInnovation(genesA);
+        const int maxB = maxInnovation(genesB);
+        const auto contains = [](const std::vector<ConnectionGene>& genes, const int innov)
+        {
+            return std::ranges::any_of(genes, [innov](const ConnectionGene& g) { return g.getInnovationNumber() == innov; });
+        };
+
+        double sumAmpDiff = 0.0;
+        double sumWidthDiff = 0.0;
+        for (const auto& gene : genesA)
+        {
+            terms.excessGenes += gene.getInnovationNumber() > maxB;
+            terms.disjointGenes += !contains(genesB, gene.getInnovationNumber()) && gene.getInnovationNumber() <= std::min(maxA, maxB);
+            for (const auto& other : genesB)
+            {
+                if (gene.getInnovationNumber() != other.getInnovationNumber())
+                    continue;
+                sumAmpDiff += std::abs(gene.getKernelAmplitude() - other.getKernelAmplitude());
+                sumWidthDiff += std::abs(gene.getKernelWidth() - other.getKernelWidth());
+            }
+        }
+        for (const auto& gene : genesB)
+        {
+            terms.excessGenes += gene.getInnovationNumber() > maxA;
+            terms.disjointGenes += !contains(genesA, gene.getInnovationNumber()) && gene.getInnovationNumber() <= std::min(maxA, maxB);
+        }
+        terms.averageConnectionDifference = CompatibilityCoefficients::amplitudeDifferenceCoefficient * sumAmpDiff
+            + CompatibilityCoefficients::widthDifferenceCoefficient * sumWidthDiff;
+        return terms;
+    }
+
+    void requireMatchesReference(const Genome& a, const Genome& b)
+    {
+        const CompatibilityTerms expected = referenceCompatibilityTerms(a, b);
+        const CompatibilityTerms actual = a.compatibilityTerms(b);
+        REQUIRE(actual.excessGenes == expected.excessGenes);
+        REQUIRE(actual.disjointGenes == expected.disjointGenes);
+        REQUIRE(std::abs(actual.averageConnectionDifference - expected.averageConnectionDifference) < 1e-9);
+    }
+}
+
+TEST_CASE("Genome::compatibilityTerms handles out-of-order insertion and removal", "[Genome]")
+{
+    const dnf_composer::element::GaussKernelParameters gkp{ 5.0, 3.0, false, false };
+    const dnf_composer::element::GaussKernelParameters wider{ 5.0, 4.0, false, false };
+
+    Genome genome1;
+    genome1.addInputGene(kDim);
+    genome1.addOutputGene(kDim);
+    for (const int innov : { 9, 0, 4, 2 })
+        genome1.addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), innov, gkp));
+
+    Genome genome2;
+    genome2.addInputGene(kDim);
+    genome2.addOutputGene(kDim);
+    for (const int innov : { 3, 4, 0 })
+        genome2.addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), innov, wider));
+
+    // {0, 2, 4, 9} vs {0, 3, 4}: 9 is excess; 2 and 3 are disjoint; 0 and 4 match.
+    CompatibilityTerms terms = genome1.compatibilityTerms(genome2);
+    REQUIRE(terms.excessGenes == 1);
+    REQUIRE(terms.disjointGenes == 2);
+    REQUIRE(terms.averageConnectionDifference == genome1.averageConnectionDifference(genome2));
+    requireMatchesReference(genome1, genome2);
+    requireMatchesReference(genome2, genome1);
+
+    genome1.removeConnectionGene(9);
+    genome1.removeConnectionGene(0);
+    // {2, 4} vs {0, 3, 4}: no excess; 2, 0 and 3 are disjoint; only 4 matches.
+    terms = genome1.compatibilityTerms(genome2);
+    REQUIRE(terms.excessGenes == 0);
+    REQUIRE(terms.disjointGenes == 3);
+    requireMatchesReference(genome1, genome2);
+
+    const Genome empty;
+    requireMatchesReference(genome1, empty);
+    requireMatchesReference(empty, genome1);
+    REQUIRE(empty.compatibilityTerms(empty).excessGenes == 0);
+}
+
+TEST_CASE("Genome::compatibilityTerms stays consistent with the genes through mutation", "[Genome]")
+{
+    resetGlobalState();
+    Genome genome1;
+    genome1.addInputGene(kDim);
+    genome1.addOutputGene(kDim);
+    genome1.addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), 1));
+    Genome genome2 = genome1;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        genome1.mutate();
+        if (i % 2 == 0)
+            genome2.mutate();
+        requireMatchesReference(genome1, genome2);
+        requireMatchesReference(genome2, genome1);
+    }
+}
@@ -5,9 +5,9 @@
 namespace neat_dnfs::test {
 
 // FieldGene's usual constructor randomizes everything that decides whether a
-// field can hold a bump: tau and restingLevel (FieldGene::initializeNeuralField),
+// field can hold a bump: tau and restingLevel (FieldGene::makeNeuralFieldParameters),
 // the kernel type (80/20 Gauss/Mexican-hat), and the Gauss kernel's width,
-// amplitude and global amplitude (FieldGene::initializeGaussKernel). Unlucky
+// amplitude and global amplitude (FieldGene::makeGaussKernelParameters). Unlucky
 // draws land in a regime where no bump forms, so any fixture asserting on bump
 // formation flakes -- that is what made
 // "twoBumpsAtPositionWithAmplitudeAndWidth does not credit the same bump ..."
@@ -31,8 +31,8 @@ inline FieldGene makeFixedFieldGene(const FieldGeneType type, const int id)
 
     const ElementDimensions dimensions{ DimensionConstants::xSize, DimensionConstants::dx };
 
-    // Named "nf <id>": Solution::buildPhenotype() copies the element name off
-    // the gene's own NeuralField, and fixtures look the field up by that name.
+    // Named "nf <id>" to match FieldGene::getNeuralFieldName(), which is what
+    // Solution::buildPhenotype() names the field and fixtures look it up by.
     const ElementCommonParameters nfcp{
         std::format("{}{}", NeuralFieldConstants::namePrefix, id), dimensions };
     const NeuralFieldParameters nfp{ NeuralFieldConstants::tau,
@@ -0,0 +1,42 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "neat_tools/noise_tape.h"
+
+using namespace neat_dnfs;
+
+namespace
+{
+    constexpr size_t fieldSize = 100;
+}
+
+TEST_CASE("NoiseTape rows are reproducible, wrap around and differ between lanes", "[NoiseTape]")
+{
+    const tools::NoiseTape tape(64, fieldSize, 7);
+    const tools::NoiseTape same(64, fieldSize, 7);
+    const tools::NoiseTape other(64, fieldSize, 8);
+
+    const auto row = tape.row(3, 1);
+    REQUIRE(row.size() == fieldSize);
+    REQUIRE(std::ranges::equal(row, same.row(3, 1)));
+    REQUIRE(std::ranges::equal(row, tape.row(3 + 64, 1)));
+    REQUIRE_FALSE(std::ranges::equal(row, tape.row(3, 2)));
+    REQUIRE_FALSE(std::ranges::equal(row, other.row(3, 1)));
+
+    double sum = 0.0;
+    double sumOfSquares = 0.0;
+    for (size_t step = 0; step < tape.getNumSteps(); ++step)
+        for (const double value : tape.row(step, 0))
+        {
+            sum += value;
+            sumOfSquares += value * value;
+        }
+    const auto count = static_cast<double>(tape.getNumSteps() * fieldSize);
+    REQUIRE(sum / count == Catch::Approx(0.0).margin(0.05));
+    REQUIRE(sumOfSquares / count == Catch::Approx(1.0).margin(0.05));
+
+    REQUIRE_THROWS_AS(tools::NoiseTape(0, fieldSize, 7), std::invalid_argument);
+}
@@ -1,10 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <cmath>
+#include <sstream>
 #include <thread>
 #include <set>
 
 #include "neat/population.h"
+#include "neat_tools/binary_io.h"
 #include "solutions/detection_instability.h"
 #include "test_helpers.h"
 #include "test_population_access.h"
@@ -288,6 +290,94 @@ TEST_CASE("Population::reproduceAndSelect erases extinct species from the specie
         REQUIRE_FALSE(species->isExtinct());
 }
 
+TEST_CASE("Population validation reports duplicate solutions under ValidationPolicy::Log", "[Population][Validation]")
+{
+    resetGlobalState();
+    PopulationParameters parameters(200, 1, 1e9, false);
+    parameters.validationMode = ValidationMode::Sampled;
+    parameters.validationSampleSize = 8;
+    Population population(parameters, std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.setValidationPolicy(ValidationPolicy::Log);
+    population.initialize();
+
+    PopulationTestAccess::validateUniqueSolutions(population);
+    PopulationTestAccess::validateUniqueGenesInGenomes(population);
+    REQUIRE(population.getValidationReport().clean());
+
+    auto& solutions = PopulationTestAccess::solutions(population);
+    solutions[150] = solutions[3];
+    solutions[151] = solutions[3];
+    PopulationTestAccess::validateUniqueSolutions(population);
+    REQUIRE(population.getValidationReport().count(ValidationCheck::UniqueSolutions) == 1);
+    REQUIRE(population.getValidationReport().messages.size() == 1);
+}
+
+TEST_CASE("Population validation reports a connection gene duplicated within a genome", "[Population][Validation]")
+{
+    resetGlobalState();
+    PopulationParameters parameters(4, 1, 1e9, false);
+    parameters.validationMode = ValidationMode::Full;
+    Population population(parameters, std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.setValidationPolicy(ValidationPolicy::Log);
+    population.initialize();
+
+    PopulationTestAccess::validateUniqueGenesInGenomes(population);
+    REQUIRE(population.getValidationReport().clean());
+
+    // Genome::addConnectionGene() skips a gene the genome already holds, but
+    // deserialize() restores genes as written, duplicates included. Two
+    // identical genes compare equal, so the old pairwise check's != guard
+    // never reported them.
+    auto& genome = SolutionTestAccess::genome(*PopulationTestAccess::solutions(population)[0]);
+    const ConnectionGene gene(ConnectionTuple(1, 2), 7,
+        dnf_composer::element::GaussKernelParameters{ 3.0, 5.0, 0.0, true, true });
+    std::stringstream stream;
+    tools::BinaryWriter writer(stream);
+    writer.write(static_cast<std::uint64_t>(genome.getFieldGenes().size()));
+    for (const auto& fieldGene : genome.getFieldGenes())
+        fieldGene.serialize(writer);
+    writer.write(std::uint64_t{ 2 });
+    gene.serialize(writer);
+    gene.serialize(writer);
+    writer.writeString("");
+    tools::BinaryReader reader(stream);
+    genome.deserialize(reader);
+    REQUIRE(genome.getConnectionGenes().size() == 2);
+
+    PopulationTestAccess::validateUniqueGenesInGenomes(population);
+    REQUIRE(population.getValidationReport().count(ValidationCheck::UniqueGenesInGenomes) == 1);
+}
+
+TEST_CASE("Population validation runs in full under ValidationPolicy::Throw whatever the mode", "[Population][Validation]")
+{
+    resetGlobalState();
+    PopulationParameters parameters(20, 1, 1e9, false);
+    parameters.validationMode = ValidationMode::Off;
+    Population population(parameters, std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.setValidationPolicy(ValidationPolicy::Throw);
+    population.initialize();
+
+    auto& solutions = PopulationTestAccess::solutions(population);
+    solutions[1] = solutions[0];
+    REQUIRE_THROWS_AS(PopulationTestAccess::validateUniqueSolutions(population), ValidationError);
+}
+
+TEST_CASE("Population::evolve with sampled validation reports nothing on a healthy run", "[Population][Validation]")
+{
+    resetGlobalState();
+    PopulationParameters parameters(60, 4, 1e9, false);
+    parameters.validationMode = ValidationMode::Sampled;
+    parameters.validationSampleSize = 10;
+    parameters.seed = 3;
+    Population population(parameters, std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.setValidationPolicy(ValidationPolicy::Log);
+    population.initialize();
+    population.evolve();
+
+    REQUIRE(population.getCurrentGeneration() == 4);
+    REQUIRE(population.getValidationReport().clean());
+}
+
 TEST_CASE("PopulationParameters - parallelEvolution defaults to true", "[Population]")
 {
     const PopulationParameters parameters(10, 5, 0.9);
@@ -540,3 +630,44 @@ TEST_CASE("Population::evolve with parallel evaluation and a real solution does
         REQUIRE(population.getBestSolution() != nullptr);
     }
 }
+
+namespace
+{
+    struct SeededRun
+    {
+        std::vector<double> bestFitnessHistory;
+        std::vector<int> bestSolutionIdHistory;
+        std::vector<std::uint64_t> genomeHashes;
+    };
+
+    SeededRun runSeeded(const std::uint64_t seed, const size_t threads)
+    {
+        resetGlobalState();
+        PopulationParameters parameters(20, 5, 1e9);
+        parameters.seed = seed;
+        Population population(parameters, std::make_shared<RandomFitnessSolution>(makeTopology(1, 1)), false);
+        population.setExecutor(std::make_shared<tools::ThreadPool>(threads));
+        population.initialize();
+        population.evolve();
+
+        SeededRun run{ population.getBestFitnessHistory(), population.getBestSolutionIdHistory(), {} };
+        for (const auto& solution : population.getSolutions())
+            run.genomeHashes.push_back(solution->getGenome().contentHash());
+        return run;
+    }
+}
+
+TEST_CASE("Population::evolve with a seed is independent of the thread count", "[Population][thread-safety]")
+{
+    const SeededRun serial = runSeeded(7, 1);
+    const SeededRun parallel = runSeeded(7, 4);
+
+    REQUIRE(parallel.bestFitnessHistory == serial.bestFitnessHistory);
+    REQUIRE(parallel.bestSolutionIdHistory == serial.bestSolutionIdHistory);
+    REQUIRE(parallel.genomeHashes == serial.genomeHashes);
+}
+
+TEST_CASE("Population::evolve with different seeds draws different numbers", "[Population]")
+{
+    REQUIRE(runSeeded(7, 2).bestFitnessHistory != runSeeded(8, 2).bestFitnessHistory);
+}
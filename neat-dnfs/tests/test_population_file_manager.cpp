@@ -3,8 +3,10 @@
 #include <filesystem>
 #include <ctime>
 #include <array>
+#include <fstream>
 
 #include "neat/population.h"
+#include "neat_tools/telemetry.h"
 #include "test_helpers.h"
 #include "test_stub_solution.h"
 
@@ -73,6 +75,19 @@ TEST_CASE("PopulationFileManager writes per-generation artifacts to disk", "[Pop
     }
     REQUIRE(wroteAtLeastOneFile);
 
+    if (PopulationConstants::saveOverview && PopulationConstants::saveTelemetry)
+    {
+        std::ifstream telemetryFile(runDirectory + "telemetry_generations.bin", std::ios::binary);
+        REQUIRE(telemetryFile.is_open());
+        const tools::TelemetryTable telemetry = tools::readTelemetry(telemetryFile);
+        REQUIRE(telemetry.numRows() == static_cast<size_t>(population.getCurrentGeneration()));
+        for (size_t row = 0; row < telemetry.numRows(); ++row)
+        {
+            REQUIRE(telemetry.int64At("generation", row) == static_cast<std::int64_t>(row));
+            REQUIRE(telemetry.int64At("numSolutions", row) == 5);
+        }
+    }
+
     // Remove only this run's own timestamped directory, not the whole shared
     // data/Counting/ root, so other/concurrent runs under that name are untouched.
     std::filesystem::remove_all(runDirectory);
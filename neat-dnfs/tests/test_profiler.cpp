@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "neat/population.h"
+#include "neat_tools/profiler.h"
+#include "test_helpers.h"
+#include "test_stub_solution.h"
+
+using namespace neat_dnfs;
+using namespace neat_dnfs::test;
+
+namespace
+{
+    size_t countOccurrences(const std::string& text, const std::string& pattern)
+    {
+        size_t count = 0;
+        for (size_t at = text.find(pattern); at != std::string::npos; at = text.find(pattern, at + 1))
+            ++count;
+        return count;
+    }
+}
+
+TEST_CASE("PhaseHistogram buckets durations by powers of two", "[Profiler]")
+{
+    tools::PhaseHistogram histogram;
+    REQUIRE(histogram.quantileNanoseconds(0.5) == 0);
+
+    histogram.add(500);          // under a microsecond: bucket 0
+    histogram.add(3'000);        // 3 us: bucket 1
+    histogram.add(3'500);
+    histogram.add(1'000'000);    // 1 ms: bucket 9
+
+    REQUIRE(histogram.count == 4);
+    REQUIRE(histogram.totalNanoseconds == 1'007'000);
+    REQUIRE(histogram.minNanoseconds == 500);
+    REQUIRE(histogram.maxNanoseconds == 1'000'000);
+    REQUIRE(histogram.buckets[0] == 1);
+    REQUIRE(histogram.buckets[1] == 2);
+    REQUIRE(histogram.buckets[9] == 1);
+    REQUIRE(histogram.quantileNanoseconds(0.5) == 4'000);
+    REQUIRE(histogram.quantileNanoseconds(1.0) == 1'000'000);
+}
+
+TEST_CASE("Profiler collects timers from every thread once", "[Profiler]")
+{
+    auto& profiler = tools::Profiler::instance();
+    profiler.collect();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([]()
+        {
+            for (int i = 0; i < 10; ++i)
+            {
+                const tools::ScopedPhaseTimer timer(tools::Phase::TestPhenotype);
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+    {
+        const tools::ScopedPhaseTimer timer(tools::Phase::Speciate);
+    }
+
+    const auto profile = profiler.collect();
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::TestPhenotype)].count == 40);
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::Speciate)].count == 1);
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::Evaluate)].count == 0);
+
+    const auto drained = profiler.collect();
+    REQUIRE(drained[static_cast<size_t>(tools::Phase::TestPhenotype)].count == 0);
+}
+
+TEST_CASE("Profiler writes traced phases as Chrome trace events", "[Profiler]")
+{
+    auto& profiler = tools::Profiler::instance();
+    profiler.collect();
+    profiler.clearTrace();
+
+    profiler.setTracing(true);
+    {
+        const tools::ScopedPhaseTimer timer(tools::Phase::BuildPhenotype);
+    }
+    {
+        const tools::ScopedPhaseTimer timer(tools::Phase::ClearPhenotype);
+    }
+    profiler.collect();
+    profiler.setTracing(false);
+    {
+        const tools::ScopedPhaseTimer timer(tools::Phase::Upkeep); // not traced
+    }
+    profiler.collect();
+
+    std::ostringstream trace;
+    profiler.writeChromeTrace(trace);
+    const std::string json = trace.str();
+    REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    REQUIRE(countOccurrences(json, "\"ph\":\"X\"") == 2);
+    REQUIRE(countOccurrences(json, "\"name\":\"buildPhenotype\"") == 1);
+    REQUIRE(countOccurrences(json, "\"name\":\"clearPhenotype\"") == 1);
+    REQUIRE(countOccurrences(json, "\"name\":\"upkeep\"") == 0);
+
+    profiler.clearTrace();
+}
+
+TEST_CASE("Population::getPhaseProfile times the last generation only in profiling builds", "[Profiler]")
+{
+    resetGlobalState();
+    Population population(PopulationParameters(10, 3, 1e9, false),
+        std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.initialize();
+    population.evolve();
+
+    const auto& profile = population.getPhaseProfile();
+    const std::uint64_t expected = tools::profilingEnabled ? 1 : 0;
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::Evaluate)].count == expected);
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::Speciate)].count == expected);
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::Upkeep)].count == expected);
+    REQUIRE(profile[static_cast<size_t>(tools::Phase::ReproduceAndSelect)].count == expected);
+}
@@ -4,6 +4,7 @@
 #include <cmath>
 #include <type_traits>
 
+#include "neat/kernel_parameters.h"
 #include "neat/solution.h"
 #include "solutions/detection_instability.h"
 #include "test_helpers.h"
@@ -212,7 +213,7 @@ TEST_CASE("Solution Evaluation", "[Solution]")
 }
 
 // Regression test: fitness helpers (closenessToRestingLevel, noBumps, etc.)
-// all resolve their field through the shared Solution::getNeuralFieldOrThrow,
+// all resolve their field through the shared Solution::fieldHandle,
 // which must raise an indicative error rather than silently returning 0.0 --
 // a missing/wrong-type field means the solution is misconfigured, not that it
 // legitimately scored the worst possible fitness.
@@ -489,7 +490,7 @@ TEST_CASE("Solution negativePreShapednessAtPosition scores zero for a field at i
 }
 
 // Issue #68 / #56: same boundary-index guard as preShapednessAtPosition
-// (both route through the shared clampedIndexForPosition helper), checked
+// (both route through FieldSnapshot::indexOf), checked
 // directly against negativePreShapednessAtPosition at the field's own upper
 // spatial bound.
 TEST_CASE("Solution negativePreShapednessAtPosition does not read past the end of the field at the upper boundary", "[Solution]")
@@ -673,3 +674,213 @@ TEST_CASE("Solution::crossover inherits field genes from the fitter parent", "[S
     for (const auto& gene : offspring->getGenome().getFieldGenes())
         REQUIRE(fitterParent->getGenome().containsFieldGene(gene));
 }
+
+TEST_CASE("Solution::evaluate keeps the phenotype alive between evaluations", "[Solution]")
+{
+    // With SolutionConstants::persistentPhenotype, an unchanged genome must reuse
+    // the very same elements instead of tearing the simulation down and
+    // rebuilding it, and only the task's stimuli may be dropped afterwards.
+    resetGlobalState();
+    const auto topology = makeTopology(1, 1);
+    DetectionInstability solution(topology);
+    solution.initialize();
+
+    solution.evaluate();
+    REQUIRE(solution.hasPhenotype());
+    const auto fieldBefore = solution.getPhenotype().getElement("nf 1");
+    REQUIRE(fieldBefore != nullptr);
+
+    solution.evaluate();
+    REQUIRE(solution.getPhenotype().getElement("nf 1") == fieldBefore);
+    for (const auto& element : solution.getPhenotype().getElements())
+        REQUIRE(element->getLabel() != ElementLabel::GAUSS_STIMULUS);
+}
+
+TEST_CASE("Solution::evaluate rebuilds a live phenotype after a structural genome change", "[Solution]")
+{
+    resetGlobalState();
+    const auto topology = makeTopology(1, 1);
+    DetectionInstability solution(topology);
+    solution.initialize();
+
+    solution.evaluate();
+    const auto fieldBefore = solution.getPhenotype().getElement("nf 1");
+
+    solution.addFieldGene(FieldGene({ FieldGeneType::HIDDEN, 999 }));
+    solution.evaluate();
+
+    REQUIRE(solution.getPhenotype().getElement("nf 999") != nullptr);
+    REQUIRE(solution.getPhenotype().getElement("nf 1") != fieldBefore);
+}
+
+TEST_CASE("Solution::evaluate patches a live phenotype after a parameter-only mutation", "[Solution]")
+{
+    resetGlobalState();
+    ParameterMutatingSolution solution(makeTopology(1, 1));
+    solution.initialize();
+
+    solution.evaluate();
+    const std::string fieldName = solution.getGenome().getFieldGenes().front().getNeuralFieldName();
+    const auto fieldBefore = solution.getPhenotype().getElement(fieldName);
+    REQUIRE(fieldBefore != nullptr);
+
+    solution.mutateFirstFieldGeneParameters();
+    const FieldGene mutated = solution.getGenome().getFieldGenes().front();
+    REQUIRE_FALSE(mutated.getMutationsInLastGeneration().empty());
+    solution.evaluate();
+
+    // Patched in place rather than rebuilt...
+    REQUIRE(solution.getPhenotype().getElement(fieldName) == fieldBefore);
+    const auto field = std::dynamic_pointer_cast<NeuralField>(fieldBefore);
+    REQUIRE(field->getParameters().tau == mutated.getNeuralFieldParameters().tau);
+    REQUIRE(field->getParameters().startingRestingLevel == mutated.getNeuralFieldParameters().startingRestingLevel);
+    const auto kernel = std::dynamic_pointer_cast<Kernel>(solution.getPhenotype().getElement(mutated.getKernelName()));
+    REQUIRE(sameKernelParameters(kernelParametersOf(kernel), mutated.getKernelParameters()));
+
+    // ...and the same as a phenotype built from scratch.
+    const dnf_composer::Simulation fresh = solution.exportPhenotype();
+    for (const auto& gene : solution.getGenome().getFieldGenes())
+    {
+        const auto live = std::dynamic_pointer_cast<NeuralField>(solution.getPhenotype().getElement(gene.getNeuralFieldName()));
+        const auto built = std::dynamic_pointer_cast<NeuralField>(fresh.getElement(gene.getNeuralFieldName()));
+        REQUIRE(live->getParameters().tau == built->getParameters().tau);
+        REQUIRE(live->getParameters().startingRestingLevel == built->getParameters().startingRestingLevel);
+        REQUIRE(sameKernelParameters(
+            kernelParametersOf(std::dynamic_pointer_cast<Kernel>(solution.getPhenotype().getElement(gene.getKernelName()))),
+            kernelParametersOf(std::dynamic_pointer_cast<Kernel>(fresh.getElement(gene.getKernelName())))));
+    }
+}
+
+TEST_CASE("Solution::exportPhenotype leaves the live phenotype alone", "[Solution]")
+{
+    resetGlobalState();
+    DetectionInstability solution(makeTopology(1, 1));
+    solution.initialize();
+
+    solution.evaluate();
+    const auto fieldBefore = solution.getPhenotype().getElement("nf 1");
+    const auto elementsBefore = solution.getPhenotype().getNumberOfElements();
+
+    const dnf_composer::Simulation exported = solution.exportPhenotype();
+    REQUIRE(exported.getElement("nf 1") != nullptr);
+    REQUIRE(exported.getElement("nf 1") != fieldBefore);
+    REQUIRE(solution.hasPhenotype());
+    REQUIRE(solution.getPhenotype().getElement("nf 1") == fieldBefore);
+    REQUIRE(solution.getPhenotype().getNumberOfElements() == elementsBefore);
+
+    solution.evaluate();
+    REQUIRE(solution.getPhenotype().getElement("nf 1") == fieldBefore);
+}
+
+TEST_CASE("Solution phase-aware fitness runs every phase without a threshold", "[Solution]")
+{
+    resetGlobalState();
+    PhasedSolution solution(makeTopology(1, 1), { 1.0, 0.5, 0.0 });
+    solution.initialize();
+
+    solution.evaluate();
+
+    REQUIRE(solution.phasesRun == 3);
+    REQUIRE_FALSE(solution.getParameters().evaluationTruncated);
+    REQUIRE(solution.getParameters().partialFitness == std::vector<double>{ 1.0, 0.5, 0.0 });
+    REQUIRE(solution.getFitness() == Catch::Approx(0.5 * 1.0 + 0.3 * 0.5));
+}
+
+TEST_CASE("Solution phase-aware fitness stops once the threshold is out of reach", "[Solution]")
+{
+    resetGlobalState();
+    PhasedSolution solution(makeTopology(1, 1), { 0.2, 1.0, 1.0 });
+    solution.initialize();
+
+    // After phase 1 the bound is 0.5 * 0.2 + 0.3 + 0.2 = 0.6.
+    solution.setEarlyTerminationThreshold(0.6);
+    solution.evaluate();
+    REQUIRE(solution.phasesRun == 3);
+    REQUIRE_FALSE(solution.getParameters().evaluationTruncated);
+
+    solution.setEarlyTerminationThreshold(0.61);
+    solution.evaluate();
+    REQUIRE(solution.phasesRun == 1);
+    REQUIRE(solution.getParameters().evaluationTruncated);
+    REQUIRE(solution.getParameters().partialFitness.size() == 1);
+    REQUIRE(solution.getFitness() == Catch::Approx(0.1));
+    REQUIRE(solution.getFitnessUpperBound() == Catch::Approx(0.6));
+}
+
+TEST_CASE("Solution phase-aware fitness rejects undeclared terms", "[Solution]")
+{
+    resetGlobalState();
+    PhasedSolution solution(makeTopology(1, 1), { 1.0, 1.0, 1.0, 1.0 });
+    solution.initialize();
+
+    REQUIRE_THROWS_AS(solution.evaluate(), std::logic_error);
+}
+
+TEST_CASE("Solution field handles are valid until the phenotype is cleared or rebuilt", "[Solution]")
+{
+    FieldHandleSolution solution(makeTopology(1, 1));
+    solution.initialize();
+    solution.buildPhenotype();
+
+    const auto& fieldGenes = solution.getGenome().getFieldGenes();
+    const double inputRestingLevel = fieldGenes[0].getNeuralFieldParameters().startingRestingLevel;
+    const double outputRestingLevel = fieldGenes[1].getNeuralFieldParameters().startingRestingLevel;
+
+    const FieldHandle input = solution.resolve("nf 1");
+    const FieldHandle output = solution.resolve("nf 2");
+    REQUIRE(solution.restingLevelOf(input) == inputRestingLevel);
+    REQUIRE(solution.restingLevelOf(output) == outputRestingLevel);
+    REQUIRE_THROWS_AS(solution.resolve("nf 3"), std::invalid_argument);
+    REQUIRE_THROWS_AS(solution.restingLevelOf(FieldHandle{}), std::logic_error);
+
+    solution.buildPhenotype();
+    REQUIRE_THROWS_AS(solution.restingLevelOf(input), std::logic_error);
+    REQUIRE(solution.restingLevelOf(solution.resolve("nf 1")) == inputRestingLevel);
+
+    solution.clearPhenotype();
+    REQUIRE_THROWS_AS(solution.resolve("nf 1"), std::invalid_argument);
+    REQUIRE_NOTHROW(solution.evaluate());
+}
+
+TEST_CASE("Solution field snapshots are retaken after the phenotype steps", "[Solution]")
+{
+    FieldHandleSolution solution(makeTopology(1, 1));
+    solution.initialize();
+    solution.buildPhenotype();
+
+    const FieldHandle input = solution.resolve("nf 1");
+    const auto atRest = solution.activationOf(input);
+    REQUIRE(atRest.size() == static_cast<size_t>(DimensionConstants::xSize));
+    REQUIRE(solution.activationOf(input) == atRest);
+
+    solution.step();
+    REQUIRE(solution.activationOf(input) != atRest);
+}
+
+TEST_CASE("Solution::runSimulation stops a phase once the fields are at a fixed point", "[Solution]")
+{
+    resetGlobalState();
+    constexpr int steps = 2000;
+
+    SECTION("Unstimulated fields stay at rest")
+    {
+        SettlingSolution solution(makeTopology(1, 1), steps, false);
+        solution.evaluate();
+
+        const int saved = solution.getParameters().savedSimulationSteps;
+        if constexpr (SimulationConstants::adaptiveStepping)
+            REQUIRE(saved >= steps - 2 * SimulationConstants::steadyStateSteps);
+        else
+            REQUIRE(saved == 0);
+        REQUIRE_FALSE(solution.hadBump);
+    }
+
+    SECTION("A stimulated field still forms its bump before stopping")
+    {
+        SettlingSolution solution(makeTopology(1, 1), steps, true);
+        solution.evaluate();
+
+        REQUIRE(solution.hadBump);
+        REQUIRE(solution.getParameters().savedSimulationSteps < steps);
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "neat/solution.h"
+
+namespace neat_dnfs::test {
+
+// Grants tests and stubs access to Solution's genome and phenotype
+// bookkeeping. ParameterMutatingSolution edits its genome in place to reach
+// the parameter-only patch path of Solution::evaluate(), which no public
+// mutation API triggers deterministically, and has to mark the phenotype
+// stale the way Solution::mutate() does. Validation tests plant genomes the
+// public API refuses to build, such as one holding the same gene twice.
+class SolutionTestAccess
+{
+public:
+    static void invalidatePhenotype(Solution& solution) { solution.invalidatePhenotype(); }
+    static Genome& genome(Solution& solution) { return solution.genome; }
+};
+
+} // namespace neat_dnfs::test
@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "neat/solution_pool.h"
+#include "test_helpers.h"
+
+using namespace neat_dnfs;
+using namespace neat_dnfs::test;
+
+namespace
+{
+    class PooledSolution final : public Solution
+    {
+    public:
+        explicit PooledSolution(const SolutionTopology& topology)
+            : Solution(topology)
+        {
+            name = "Pooled";
+        }
+
+        SolutionPtr clone() const override
+        {
+            return SolutionPool::make<PooledSolution>(initialTopology);
+        }
+
+        SolutionPtr copy() const override
+        {
+            return clone();
+        }
+
+    private:
+        void testPhenotype() override
+        {
+            parameters.fitness = static_cast<double>(getNumConnectionGenes());
+        }
+
+        void createPhenotypeEnvironment() override {}
+    };
+
+    struct PoolFixture
+    {
+        PoolFixture() { resetGlobalState(); SolutionPool::instance()->clear(); }
+        ~PoolFixture() { SolutionPool::instance()->setCapacity(SolutionConstants::poolCapacity); SolutionPool::instance()->clear(); }
+    };
+}
+
+TEST_CASE("SolutionPool reuses released solutions", "[SolutionPool]")
+{
+    PoolFixture fixture;
+    const auto& pool = SolutionPool::instance();
+
+    SolutionPtr first = SolutionPool::make<PooledSolution>(makeTopology(1, 1));
+    const Solution* address = first.get();
+    const int firstId = first->getId();
+    first.reset();
+    REQUIRE(pool->getIdle() == 1);
+
+    const SolutionPtr second = SolutionPool::make<PooledSolution>(makeTopology(2, 1));
+    REQUIRE(second.get() == address);
+    REQUIRE(second->getId() != firstId);
+    REQUIRE(pool->getIdle() == 0);
+    REQUIRE(pool->getCreated() == 1);
+    REQUIRE(pool->getRecycled() == 1);
+}
+
+TEST_CASE("SolutionPool hands out solutions in their freshly constructed state", "[SolutionPool]")
+{
+    PoolFixture fixture;
+
+    SolutionPtr used = SolutionPool::make<PooledSolution>(makeTopology(1, 1));
+    used->initialize();
+    used->mutate();
+    used->evaluate();
+    used->setParents(3, 4);
+    used->setSpeciesId(2);
+    used->setEarlyTerminationThreshold(0.5);
+    used.reset();
+
+    const SolutionPtr recycled = SolutionPool::make<PooledSolution>(makeTopology(1, 2));
+    const PooledSolution fresh(makeTopology(1, 2));
+    REQUIRE(recycled->getGenome().isEmpty());
+    REQUIRE_FALSE(recycled->hasPhenotype());
+    REQUIRE(recycled->getPhenotype().getElements().empty());
+    REQUIRE(recycled->getParameters() == fresh.getParameters());
+    REQUIRE(recycled->getSpeciesId() == -1);
+    REQUIRE(recycled->getParents() == std::make_tuple(0, 0));
+    REQUIRE(recycled->getEarlyTerminationThreshold() == fresh.getEarlyTerminationThreshold());
+    REQUIRE(recycled->getName() == "Pooled");
+
+    recycled->initialize();
+    REQUIRE(recycled->getNumFieldGenes() == 3);
+    REQUIRE_NOTHROW(recycled->evaluate());
+}
+
+TEST_CASE("SolutionPool parks solutions without their phenotype", "[SolutionPool]")
+{
+    PoolFixture fixture;
+
+    SolutionPtr used = SolutionPool::make<PooledSolution>(makeTopology(1, 1));
+    used->initialize();
+    used->evaluate();
+    REQUIRE(used->hasPhenotype());
+    REQUIRE_FALSE(used->getPhenotype().getElements().empty());
+    const size_t fieldGeneCapacity = used->getGenome().getFieldGenes().capacity();
+
+    // The pool still owns the solution, so it can be looked at while parked.
+    const Solution* parked = used.get();
+    used.reset();
+    REQUIRE(SolutionPool::instance()->getIdle() == 1);
+    REQUIRE_FALSE(parked->hasPhenotype());
+    REQUIRE(parked->getPhenotype().getElements().empty());
+    REQUIRE(parked->getGenome().getFieldGenes().capacity() == fieldGeneCapacity);
+}
+
+TEST_CASE("SolutionPool recycled solutions cross over", "[SolutionPool]")
+{
+    PoolFixture fixture;
+
+    SolutionPool::make<PooledSolution>(makeTopology(1, 1)).reset();
+    const SolutionPtr parent = SolutionPool::make<PooledSolution>(makeTopology(1, 1));
+    parent->initialize();
+    parent->mutate();
+    REQUIRE(SolutionPool::instance()->getRecycled() == 1);
+
+    // crossover() needs shared_from_this() on a solution re-wrapped by the pool.
+    const SolutionPtr child = parent->crossover(parent);
+    REQUIRE(child->getGenome().getConnectionGenes().size() == parent->getGenome().getConnectionGenes().size());
+    REQUIRE(child->getId() != parent->getId());
+}
+
+TEST_CASE("SolutionPool parks at most its capacity", "[SolutionPool]")
+{
+    PoolFixture fixture;
+    const auto& pool = SolutionPool::instance();
+    pool->setCapacity(2);
+
+    {
+        std::vector<SolutionPtr> generation;
+        for (int i = 0; i < 5; ++i)
+            generation.push_back(SolutionPool::make<PooledSolution>(makeTopology(1, 1)));
+    }
+    REQUIRE(pool->getIdle() == 2);
+
+    pool->setCapacity(1);
+    REQUIRE(pool->getIdle() == 1);
+    pool->clear();
+    REQUIRE(pool->getIdle() == 0);
+}
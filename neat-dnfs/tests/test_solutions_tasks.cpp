@@ -9,6 +9,7 @@
 #include "solutions/inhibition_of_return.h"
 #include "solutions/and.h"
 #include "solutions/xor.h"
+#include "neat_tools/noise_tape.h"
 #include "test_helpers.h"
 
 using namespace neat_dnfs;
@@ -123,7 +124,7 @@ TEST_CASE("DelayedMatchToSample contract", "[Solutions][DelayedMatchToSample]")
 }
 
 // DelayedMatchToSample is tuned for a 360-wide field: testPhenotype() places the
-// second sample at position 100 (src/solutions/delayed_match_to_sample.cpp:73).
+// second sample at position 100 (src/solutions/delayed_match_to_sample.cpp:87).
 // DimensionConstants::xSize was lowered 360 -> 100 in fe58ccbbf, when
 // InhibitionOfReturn (positions 20/80) was integrated, without retuning this task.
 // Position 100 is therefore outside the valid [0, size) range and evaluate()
@@ -193,3 +194,45 @@ TEST_CASE("XOR evaluate produces a bounded fitness", "[Solutions][XOR]")
     REQUIRE(solution.getFitness() <= 1.0);
     REQUIRE(solution.getParameters().partialFitness.size() == 4);
 }
+
+TEST_CASE("XOR trials each start from rest and replay the noise tape", "[Solutions][XOR]")
+{
+    resetGlobalState();
+    XOR solution(makeTopology(2, 1));
+    solution.initialize();
+    solution.setNoiseTape(std::make_shared<const tools::NoiseTape>(256, DimensionConstants::xSize, 7));
+
+    // runTrials() rewinds the tape and reinitializes the fields before every
+    // trial, so nothing an earlier evaluation left behind leaks into the next.
+    solution.evaluate();
+    const auto first = solution.getParameters().partialFitness;
+    REQUIRE(first.size() == 4);
+
+    solution.evaluate();
+    REQUIRE(solution.getParameters().partialFitness == first);
+}
+
+// A threshold above the best reachable fitness (1.0) fails the first
+// continueEvaluation() check, so each multi-phase task returns after the
+// terms of its first phase.
+template <typename SolutionType>
+static void checkStopsAfterFirstPhase(const SolutionTopology& topology, const size_t firstPhaseTerms)
+{
+    SolutionType solution(topology);
+    solution.initialize();
+    solution.setEarlyTerminationThreshold(2.0);
+
+    REQUIRE_NOTHROW(solution.evaluate());
+    REQUIRE(solution.getParameters().evaluationTruncated);
+    REQUIRE(solution.getParameters().partialFitness.size() == firstPhaseTerms);
+}
+
+TEST_CASE("Multi-phase tasks stop once their threshold is out of reach", "[Solutions][EarlyTermination]")
+{
+    resetGlobalState();
+    checkStopsAfterFirstPhase<MemoryInstability>(makeTopology(1, 1), 2);
+    checkStopsAfterFirstPhase<SelectionInstability>(makeTopology(1, 1), 2);
+    checkStopsAfterFirstPhase<InhibitionOfReturn>(makeTopology(1, 1), 2);
+    checkStopsAfterFirstPhase<AND>(makeTopology(2, 1), 2);
+    checkStopsAfterFirstPhase<XOR>(makeTopology(2, 1), 1);
+}
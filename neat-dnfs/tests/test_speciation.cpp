@@ -1,5 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 #include "neat/genome.h"
 #include "neat/species.h"
 #include "neat/population.h"
@@ -193,3 +196,74 @@ TEST_CASE("Speciation: an existing species' representative stays fixed for the w
     const auto solutions = population.getSolutions();
     REQUIRE(representative == solutions.front());
 }
+
+namespace
+{
+    // Five connection genes with innovation numbers unique to @p group, so
+    // genomes of different groups are always incompatible (5 excess genes
+    // already exceed the compatibility threshold) and genomes of one group are
+    // identical.
+    void addGroupConnections(const SolutionPtr& solution, const int group)
+    {
+        for (int innovation = group * 10 + 1; innovation <= group * 10 + 5; ++innovation)
+            solution->addConnectionGene(ConnectionGene(ConnectionTuple(1, 2), innovation,
+                GaussKernelParameters{ 3.0, 5.0, 0.0, true, true }));
+    }
+
+    // For each solution, the position in speciesList of the species holding it.
+    std::vector<size_t> speciesIndexOfEachSolution(Population& population)
+    {
+        const auto speciesList = population.getSpeciesList();
+        std::vector<size_t> indices;
+        for (const auto& solution : population.getSolutions())
+        {
+            const auto it = std::ranges::find_if(speciesList,
+                [&solution](const auto& species) { return species->contains(solution); });
+            indices.push_back(static_cast<size_t>(std::distance(speciesList.begin(), it)));
+        }
+        return indices;
+    }
+}
+
+TEST_CASE("Speciation: batched parallel assignment matches the serial pass", "[Speciation][Population]")
+{
+    resetGlobalState();
+    const auto topology = makeTopology(1, 1);
+
+    const PopulationParameters serialParameters(12, 5, 1.1, false);
+    Population serial(serialParameters, std::make_shared<DetectionInstability>(topology), false);
+    const PopulationParameters parallelParameters(12, 5, 1.1, true);
+    Population parallel(parallelParameters, std::make_shared<DetectionInstability>(topology), false);
+    parallel.setExecutor(std::make_shared<tools::ThreadPool>(4));
+
+    for (Population* population : { &serial, &parallel })
+    {
+        population->initialize();
+        const auto solutions = population->getSolutions();
+        for (size_t i = 0; i < solutions.size(); ++i)
+            addGroupConnections(solutions[i], static_cast<int>(i % 3));
+        PopulationTestAccess::speciate(*population);
+    }
+    REQUIRE(serial.getSpeciesList().size() == 3);
+    REQUIRE(speciesIndexOfEachSolution(serial) == speciesIndexOfEachSolution(parallel));
+
+    // Solution 1 represents species 1. Switching it to group 0 moves it to
+    // species 0 mid-pass, so species 1 gets a new representative and the
+    // answers precomputed against the old one must not be used.
+    for (Population* population : { &serial, &parallel })
+    {
+        const auto migrating = population->getSolutions()[1];
+        REQUIRE(PopulationTestAccess::speciesList(*population)[1]->getRepresentative() == migrating);
+        migrating->clearGenome();
+        migrating->addFieldGene(makeFixedFieldGene(FieldGeneType::INPUT, 1));
+        migrating->addFieldGene(makeFixedFieldGene(FieldGeneType::OUTPUT, 2));
+        addGroupConnections(migrating, 0);
+        PopulationTestAccess::speciate(*population);
+    }
+
+    const auto expected = speciesIndexOfEachSolution(serial);
+    REQUIRE(serial.getSpeciesList().size() == 3);
+    REQUIRE(expected[1] == 0);
+    REQUIRE(expected[4] == 1);
+    REQUIRE(speciesIndexOfEachSolution(parallel) == expected);
+}
@@ -5,6 +5,7 @@
 
 #include "neat/solution.h"
 #include "test_helpers.h"
+#include "test_solution_access.h"
 
 namespace neat_dnfs::test {
 
@@ -146,9 +147,118 @@ private:
     void createPhenotypeEnvironment() override {}
 };
 
+// Stand-in for a multi-phase task (e.g. DelayedMatchToSample) that uses the
+// phase-aware fitness API: each "phase" records the next value of `terms`
+// against weights {0.5, 0.3, 0.2} and then checks continueEvaluation(), so
+// tests can tell exactly how many phases ran before early termination.
+class PhasedSolution final : public Solution
+{
+public:
+    PhasedSolution(const SolutionTopology& topology, std::vector<double> terms)
+        : Solution(topology), terms(std::move(terms))
+    {
+        name = "Phased";
+    }
+
+    PhasedSolution(const SolutionTopology& initialTopology, const dnf_composer::Simulation& phenotype)
+        : Solution(initialTopology, phenotype)
+    {
+        name = "Phased";
+    }
+
+    SolutionPtr clone() const override
+    {
+        PhasedSolution solution(initialTopology, terms);
+        return std::make_shared<PhasedSolution>(solution);
+    }
+
+    SolutionPtr copy() const override
+    {
+        PhasedSolution solution(initialTopology, phenotype);
+        solution.terms = terms;
+        return std::make_shared<PhasedSolution>(solution);
+    }
+
+    std::vector<double> terms;
+    int phasesRun = 0;
+
+private:
+    void testPhenotype() override
+    {
+        phasesRun = 0;
+        declarePartialFitnessWeights({ 0.5, 0.3, 0.2 });
+        for (const double term : terms)
+        {
+            ++phasesRun;
+            recordPartialFitness(term);
+            if (!continueEvaluation())
+                return;
+        }
+    }
+
+    void createPhenotypeEnvironment() override {}
+};
+
+// Stand-in that only runs the simulation for `steps` steps, optionally with a
+// stimulus on "nf 1", so tests can observe how many steps adaptive stepping
+// (SimulationConstants::adaptiveStepping) skips. Genes are fixed, so the
+// fields reliably settle (and, when stimulated, form one bump).
+class SettlingSolution final : public Solution
+{
+public:
+    SettlingSolution(const SolutionTopology& topology, const int steps, const bool stimulate)
+        : Solution(topology), steps(steps), stimulate(stimulate)
+    {
+        name = "Settling";
+        addFieldGene(makeFixedFieldGene(FieldGeneType::INPUT, 1));
+        addFieldGene(makeFixedFieldGene(FieldGeneType::OUTPUT, 2));
+    }
+
+    SettlingSolution(const SolutionTopology& initialTopology, const dnf_composer::Simulation& phenotype)
+        : Solution(initialTopology, phenotype)
+    {
+        name = "Settling";
+    }
+
+    SolutionPtr clone() const override
+    {
+        SettlingSolution solution(initialTopology, steps, stimulate);
+        return std::make_shared<SettlingSolution>(solution);
+    }
+
+    SolutionPtr copy() const override
+    {
+        SettlingSolution solution(initialTopology, phenotype);
+        solution.steps = steps;
+        solution.stimulate = stimulate;
+        return std::make_shared<SettlingSolution>(solution);
+    }
+
+    int steps = 0;
+    bool stimulate = false;
+    bool hadBump = false;
+
+private:
+    void testPhenotype() override
+    {
+        initSimulation();
+        if (stimulate)
+        {
+            addGaussianStimulus("nf 1",
+                dnf_composer::element::GaussStimulusParameters{ GaussStimulusConstants::width, GaussStimulusConstants::amplitude, 50.0,
+                    GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
+                dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
+        }
+        runSimulation(steps);
+        hadBump = noBumps(fieldHandle("nf 1")) == 0.0;
+    }
+
+    void createPhenotypeEnvironment() override {}
+};
+
 // Stand-in whose testPhenotype() calls a fitness helper with a field name
 // that doesn't exist in its own topology, used to verify that the shared
-// null-field guard (Solution::getNeuralFieldOrThrow) raises an indicative
+// null-field guard (Solution::fieldHandle) raises an indicative
 // error instead of silently treating a configuration bug as a fitness score.
 class MissingFieldSolution final : public Solution
 {
@@ -181,7 +291,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = closenessToRestingLevel("this field does not exist");
+        parameters.fitness = closenessToRestingLevel(fieldHandle("this field does not exist"));
     }
 
     void createPhenotypeEnvironment() override {}
@@ -189,9 +299,8 @@ private:
 
 // Stand-in whose testPhenotype() calls a fitness helper with the name of a
 // real phenotype element that exists but isn't a NeuralField (a GaussStimulus),
-// used to verify Solution::getNeuralFieldOrThrow rejects a wrong-type element
-// the same way it rejects a missing one, rather than only guarding against
-// phenotype.getElement() returning null.
+// used to verify Solution::fieldHandle rejects a wrong-type element
+// the same way it rejects a missing one.
 class WrongElementTypeSolution final : public Solution
 {
 public:
@@ -228,7 +337,7 @@ private:
                 GaussStimulusConstants::circularity, GaussStimulusConstants::normalization },
             dnf_composer::element::ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
 
-        parameters.fitness = closenessToRestingLevel("gs nf 1 50");
+        parameters.fitness = closenessToRestingLevel(fieldHandle("gs nf 1 50"));
     }
 
     void createPhenotypeEnvironment() override {}
@@ -236,7 +345,7 @@ private:
 
 // Stand-in whose testPhenotype() calls twoBumpsAtPositionWithAmplitudeAndWidth
 // with a field name that doesn't exist, used to verify the shared null-field
-// guard (Solution::getNeuralFieldOrThrow) also covers the multi-bump fitness
+// guard (Solution::fieldHandle) also covers the multi-bump fitness
 // primitives named in issue #56, not just closenessToRestingLevel.
 class MissingFieldTwoBumpsSolution final : public Solution
 {
@@ -270,7 +379,7 @@ private:
     {
         initSimulation();
         parameters.fitness = twoBumpsAtPositionWithAmplitudeAndWidth(
-            "this field does not exist", 30.0, 10.0, 10.0, 70.0, 10.0, 10.0);
+            fieldHandle("this field does not exist"), 30.0, 10.0, 10.0, 70.0, 10.0, 10.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -312,7 +421,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = preShapednessAtPosition("nf 1", static_cast<double>(DimensionConstants::xSize));
+        parameters.fitness = preShapednessAtPosition(fieldHandle("nf 1"), static_cast<double>(DimensionConstants::xSize));
     }
 
     void createPhenotypeEnvironment() override {}
@@ -353,7 +462,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = twoBumpsAtPositionWithAmplitudeAndWidth("nf 1", 30.0, 10.0, 10.0, 70.0, 10.0, 10.0);
+        parameters.fitness = twoBumpsAtPositionWithAmplitudeAndWidth(fieldHandle("nf 1"), 30.0, 10.0, 10.0, 70.0, 10.0, 10.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -392,7 +501,7 @@ private:
     {
         initSimulation();
         parameters.fitness = threeBumpsAtPositionWithAmplitudeAndWidth(
-            "nf 1", 20.0, 10.0, 10.0, 50.0, 10.0, 10.0, 80.0, 10.0, 10.0);
+            fieldHandle("nf 1"), 20.0, 10.0, 10.0, 50.0, 10.0, 10.0, 80.0, 10.0, 10.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -486,10 +595,9 @@ private:
             ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
         runSimulation(SimulationConstants::maxSimulationSteps);
 
-        const auto neuralField = std::dynamic_pointer_cast<NeuralField>(phenotype.getElement("nf 1"));
-        observedBumps = neuralField->getBumps();
+        observedBumps = getFieldSnapshot(fieldHandle("nf 1")).bumps;
 
-        parameters.fitness = twoBumpsAtPositionWithAmplitudeAndWidth("nf 1",
+        parameters.fitness = twoBumpsAtPositionWithAmplitudeAndWidth(fieldHandle("nf 1"),
             targetPosition, targetAmplitude, targetWidth,
             targetPosition, targetAmplitude, targetWidth);
     }
@@ -531,7 +639,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = oneBumpAtPositionWithAmplitudeAndWidth("nf 1", 50.0, 10.0, 10.0);
+        parameters.fitness = oneBumpAtPositionWithAmplitudeAndWidth(fieldHandle("nf 1"), 50.0, 10.0, 10.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -571,7 +679,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = oneBumpAtPositionWithAmplitudeAndWidth("this field does not exist", 50.0, 10.0, 10.0);
+        parameters.fitness = oneBumpAtPositionWithAmplitudeAndWidth(fieldHandle("this field does not exist"), 50.0, 10.0, 10.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -651,11 +759,10 @@ private:
             ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
         runSimulation(SimulationConstants::maxSimulationSteps);
 
-        const auto neuralField = std::dynamic_pointer_cast<NeuralField>(phenotype.getElement("nf 1"));
-        observedBumps = neuralField->getBumps();
+        observedBumps = getFieldSnapshot(fieldHandle("nf 1")).bumps;
 
         const auto& bump = observedBumps.front();
-        parameters.fitness = oneBumpAtPositionWithAmplitudeAndWidth("nf 1",
+        parameters.fitness = oneBumpAtPositionWithAmplitudeAndWidth(fieldHandle("nf 1"),
             bump.centroid, bump.amplitude, bump.width);
     }
 
@@ -696,7 +803,7 @@ private:
     {
         initSimulation();
         parameters.fitness = threeBumpsAtPositionWithAmplitudeAndWidth(
-            "this field does not exist",
+            fieldHandle("this field does not exist"),
             20.0, 10.0, 10.0, 50.0, 10.0, 10.0, 80.0, 10.0, 10.0);
     }
 
@@ -771,11 +878,10 @@ private:
             ElementDimensions{ DimensionConstants::xSize, DimensionConstants::dx });
         runSimulation(SimulationConstants::maxSimulationSteps);
 
-        const auto neuralField = std::dynamic_pointer_cast<NeuralField>(phenotype.getElement("nf 1"));
-        observedBumps = neuralField->getBumps();
+        observedBumps = getFieldSnapshot(fieldHandle("nf 1")).bumps;
 
         const auto& bump = observedBumps.front();
-        parameters.fitness = threeBumpsAtPositionWithAmplitudeAndWidth("nf 1",
+        parameters.fitness = threeBumpsAtPositionWithAmplitudeAndWidth(fieldHandle("nf 1"),
             bump.centroid, bump.amplitude, bump.width,
             bump.centroid, bump.amplitude, bump.width,
             bump.centroid, bump.amplitude, bump.width);
@@ -817,7 +923,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = preShapednessAtPosition("this field does not exist", 50.0);
+        parameters.fitness = preShapednessAtPosition(fieldHandle("this field does not exist"), 50.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -860,7 +966,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = preShapednessAtPosition("nf 1", 50.0);
+        parameters.fitness = preShapednessAtPosition(fieldHandle("nf 1"), 50.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -899,7 +1005,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = negativePreShapednessAtPosition("this field does not exist", 50.0);
+        parameters.fitness = negativePreShapednessAtPosition(fieldHandle("this field does not exist"), 50.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -941,7 +1047,7 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = negativePreShapednessAtPosition("nf 1", 50.0);
+        parameters.fitness = negativePreShapednessAtPosition(fieldHandle("nf 1"), 50.0);
     }
 
     void createPhenotypeEnvironment() override {}
@@ -949,7 +1055,7 @@ private:
 
 // Same boundary case as BoundaryPositionPreShapednessSolution, but for
 // negativePreShapednessAtPosition -- it too resolves position to an index via
-// the shared clampedIndexForPosition helper (issue #56), so the upper spatial
+// FieldSnapshot::indexOf (issue #56), so the upper spatial
 // bound (DimensionConstants::xSize) must not read past the end of the
 // activation component either.
 class BoundaryPositionNegativePreShapednessSolution final : public Solution
@@ -983,7 +1089,154 @@ private:
     void testPhenotype() override
     {
         initSimulation();
-        parameters.fitness = negativePreShapednessAtPosition("nf 1", static_cast<double>(DimensionConstants::xSize));
+        parameters.fitness = negativePreShapednessAtPosition(fieldHandle("nf 1"), static_cast<double>(DimensionConstants::xSize));
+    }
+
+    void createPhenotypeEnvironment() override {}
+};
+
+// Stand-in whose fitness is a random draw mixed with its genome size, so
+// runs only agree if every evaluation drew the same numbers -- used to check
+// that seeded runs don't depend on which thread evaluated which solution.
+class RandomFitnessSolution final : public Solution
+{
+public:
+    explicit RandomFitnessSolution(const SolutionTopology& topology)
+        : Solution(topology)
+    {
+        name = "RandomFitness";
+    }
+
+    RandomFitnessSolution(const SolutionTopology& initialTopology, const dnf_composer::Simulation& phenotype)
+        : Solution(initialTopology, phenotype)
+    {
+        name = "RandomFitness";
+    }
+
+    SolutionPtr clone() const override
+    {
+        RandomFitnessSolution solution(initialTopology);
+        return std::make_shared<RandomFitnessSolution>(solution);
+    }
+
+    SolutionPtr copy() const override
+    {
+        RandomFitnessSolution solution(initialTopology, phenotype);
+        return std::make_shared<RandomFitnessSolution>(solution);
+    }
+
+private:
+    void testPhenotype() override
+    {
+        parameters.fitness = tools::utils::generateRandomDouble(0.0, 0.5) +
+            static_cast<double>(getNumConnectionGenes()) / 100.0;
+    }
+
+    void createPhenotypeEnvironment() override {}
+};
+
+// Stand-in that exposes field-handle resolution and field snapshots, used to
+// check that a FieldHandle stays tied to the phenotype it was resolved on and
+// that a snapshot is retaken once the phenotype steps.
+class FieldHandleSolution final : public Solution
+{
+public:
+    explicit FieldHandleSolution(const SolutionTopology& topology)
+        : Solution(topology)
+    {
+        name = "FieldHandle";
+    }
+
+    FieldHandleSolution(const SolutionTopology& initialTopology, const dnf_composer::Simulation& phenotype)
+        : Solution(initialTopology, phenotype)
+    {
+        name = "FieldHandle";
+    }
+
+    SolutionPtr clone() const override
+    {
+        FieldHandleSolution solution(initialTopology);
+        return std::make_shared<FieldHandleSolution>(solution);
+    }
+
+    SolutionPtr copy() const override
+    {
+        FieldHandleSolution solution(initialTopology, phenotype);
+        return std::make_shared<FieldHandleSolution>(solution);
+    }
+
+    FieldHandle resolve(const std::string& fieldName) const { return fieldHandle(fieldName); }
+    double restingLevelOf(const FieldHandle field) const { return getFieldSnapshot(field).restingLevel; }
+    std::vector<double> activationOf(const FieldHandle field) const { return getFieldSnapshot(field).activation; }
+    void step() { runSimulation(1); }
+
+private:
+    void testPhenotype() override
+    {
+        parameters.fitness = closenessToRestingLevel(fieldHandle("nf 1"));
+    }
+
+    void createPhenotypeEnvironment() override {}
+};
+
+// Stand-in that can mutate its first field gene's parameters without
+// touching the genome's structure, the kind of change Solution::evaluate()
+// patches into a live phenotype instead of rebuilding it.
+class ParameterMutatingSolution final : public Solution
+{
+public:
+    explicit ParameterMutatingSolution(const SolutionTopology& topology)
+        : Solution(topology)
+    {
+        name = "ParameterMutating";
+    }
+
+    ParameterMutatingSolution(const SolutionTopology& initialTopology, const dnf_composer::Simulation& phenotype)
+        : Solution(initialTopology, phenotype)
+    {
+        name = "ParameterMutating";
+    }
+
+    SolutionPtr clone() const override
+    {
+        ParameterMutatingSolution solution(initialTopology);
+        return std::make_shared<ParameterMutatingSolution>(solution);
+    }
+
+    SolutionPtr copy() const override
+    {
+        ParameterMutatingSolution solution(initialTopology, phenotype);
+        return std::make_shared<ParameterMutatingSolution>(solution);
+    }
+
+    void mutateFirstFieldGeneParameters()
+    {
+        const FieldGene original = genome.getFieldGenes().front().clone();
+        FieldGene mutated = original;
+        // A kernel type mutation renames the kernel element, which is a
+        // structural change; redraw until only parameters changed.
+        do
+        {
+            mutated = original;
+            mutated.mutate();
+        } while (mutated.getKernelLabel() != original.getKernelLabel() || mutated.isCloneOf(original));
+
+        Genome edited;
+        edited.addFieldGene(mutated);
+        for (size_t i = 1; i < genome.getFieldGenes().size(); ++i)
+            edited.addFieldGene(genome.getFieldGenes()[i]);
+        for (const auto& connectionGene : genome.getConnectionGenes())
+            edited.addConnectionGene(connectionGene);
+        genome = edited;
+        SolutionTestAccess::invalidatePhenotype(*this);
+    }
+
+private:
+    void testPhenotype() override
+    {
+        initSimulation();
+        runSimulation(10);
+        parameters.fitness = closenessToRestingLevel(fieldHandle("nf 1"));
     }
 
     void createPhenotypeEnvironment() override {}
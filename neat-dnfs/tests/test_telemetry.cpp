@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "neat_tools/telemetry.h"
+
+using namespace neat_dnfs;
+
+namespace
+{
+    const std::vector<tools::TelemetryColumn> schema{
+        { "generation", tools::TelemetryColumnType::Int64 },
+        { "bestFitness", tools::TelemetryColumnType::Float64 },
+    };
+
+    std::string telemetryPath(const std::string& name)
+    {
+        const auto path = std::filesystem::temp_directory_path() / ("neat_dnfs_" + name + ".bin");
+        std::filesystem::remove(path);
+        return path.string();
+    }
+
+    tools::TelemetryTable readBack(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return tools::readTelemetry(file);
+    }
+}
+
+TEST_CASE("TelemetryWriter writes records back in batches", "[Telemetry]")
+{
+    const std::string path = telemetryPath("telemetry_batches");
+    {
+        tools::TelemetryWriter writer(path, schema, 2);
+        for (int generation = 0; generation < 5; ++generation)
+            writer.append({ generation, 0.25 * generation });
+
+        // Two full batches are on disk, the fifth record is still buffered.
+        REQUIRE(writer.getBufferedRows() == 1);
+        REQUIRE(readBack(path).numRows() == 4);
+    }
+
+    const tools::TelemetryTable table = readBack(path);
+    REQUIRE(table.schema == schema);
+    REQUIRE(table.numRows() == 5);
+    for (size_t row = 0; row < 5; ++row)
+    {
+        REQUIRE(table.int64At("generation", row) == static_cast<std::int64_t>(row));
+        REQUIRE(table.float64At("bestFitness", row) == 0.25 * static_cast<double>(row));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("TelemetryWriter converts values to their column's type", "[Telemetry]")
+{
+    const std::string path = telemetryPath("telemetry_conversion");
+    {
+        tools::TelemetryWriter writer(path, schema, 8);
+        writer.append({ 3.9, 7 });
+        writer.append({ true, -1 });
+        REQUIRE_THROWS_AS(writer.append({ 1 }), std::invalid_argument);
+    }
+
+    const tools::TelemetryTable table = readBack(path);
+    REQUIRE(table.numRows() == 2);
+    REQUIRE(table.int64At("generation", 0) == 3);
+    REQUIRE(table.float64At("bestFitness", 0) == 7.0);
+    REQUIRE(table.int64At("generation", 1) == 1);
+    REQUIRE(table.float64At("bestFitness", 1) == -1.0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("TelemetryWriter appends to an existing file and drops an incomplete batch", "[Telemetry]")
+{
+    const std::string path = telemetryPath("telemetry_append");
+    {
+        tools::TelemetryWriter writer(path, schema, 4);
+        writer.append({ 0, 0.5 });
+        writer.append({ 1, 1.5 });
+    }
+
+    // A batch cut short, as a run killed mid-write would leave it.
+    const auto completeSize = std::filesystem::file_size(path);
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        const std::uint64_t rows = 3;
+        file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+        file.write("partial", 7);
+    }
+    REQUIRE(readBack(path).numRows() == 2);
+
+    {
+        tools::TelemetryWriter writer(path, schema, 4);
+        REQUIRE(std::filesystem::file_size(path) == completeSize);
+        writer.append({ 2, 2.5 });
+    }
+
+    const tools::TelemetryTable table = readBack(path);
+    REQUIRE(table.numRows() == 3);
+    REQUIRE(table.int64At("generation", 2) == 2);
+    REQUIRE(table.float64At("bestFitness", 2) == 2.5);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("TelemetryWriter refuses a file of another schema", "[Telemetry]")
+{
+    const std::string path = telemetryPath("telemetry_schema");
+    {
+        tools::TelemetryWriter writer(path, schema, 4);
+    }
+    const std::vector<tools::TelemetryColumn> other{ { "generation", tools::TelemetryColumnType::Int64 } };
+    REQUIRE_THROWS_AS(tools::TelemetryWriter(path, other, 4), std::runtime_error);
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "Current generation: 0 Number of solutions: 10";
+    }
+    REQUIRE_THROWS_AS(tools::TelemetryWriter(path, schema, 4), std::runtime_error);
+    REQUIRE_THROWS_AS(readBack(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "neat_tools/thread_pool.h"
+#include "neat/population.h"
+#include "test_helpers.h"
+#include "test_stub_solution.h"
+
+using namespace neat_dnfs;
+using namespace neat_dnfs::test;
+
+TEST_CASE("ThreadPool - worker count is configurable", "[ThreadPool]")
+{
+    const tools::ThreadPool pool(3);
+    REQUIRE(pool.size() == 3);
+    REQUIRE_FALSE(pool.isWorkerThread());
+
+    const tools::ThreadPool defaultPool;
+    REQUIRE(defaultPool.size() == std::max(1u, std::thread::hardware_concurrency()));
+}
+
+TEST_CASE("ThreadPool::parallelFor runs every index exactly once", "[ThreadPool]")
+{
+    tools::ThreadPool pool(4);
+    constexpr size_t count = 1000;
+    std::vector<std::atomic<int>> hits(count);
+
+    pool.parallelFor(count, [&hits](const size_t i) { ++hits[i]; });
+
+    for (const auto& hit : hits)
+        REQUIRE(hit.load() == 1);
+
+    size_t executed = 0;
+    for (const auto& statistics : pool.getWorkerStatistics())
+    {
+        executed += statistics.tasksExecuted;
+        REQUIRE(statistics.queueDepth == 0);
+    }
+    REQUIRE(executed == count);
+}
+
+TEST_CASE("ThreadPool::parallelFor rethrows the first exception after all tasks ran", "[ThreadPool]")
+{
+    tools::ThreadPool pool(4);
+    std::atomic<int> ran{ 0 };
+
+    REQUIRE_THROWS_AS(pool.parallelFor(64, [&ran](const size_t i)
+        {
+            ++ran;
+            if (i % 8 == 0)
+                throw std::runtime_error("task failed");
+        }), std::runtime_error);
+    REQUIRE(ran.load() == 64);
+
+    // The pool is still usable afterwards.
+    std::atomic<int> after{ 0 };
+    pool.parallelFor(16, [&after](size_t) { ++after; });
+    REQUIRE(after.load() == 16);
+}
+
+TEST_CASE("ThreadPool - nested parallelFor from inside a task does not deadlock", "[ThreadPool]")
+{
+    // Two workers and eight outer tasks that each wait on an inner group: the
+    // waiting workers must run the inner tasks themselves.
+    tools::ThreadPool pool(2);
+    std::atomic<int> inner{ 0 };
+    std::atomic<bool> onWorker{ true };
+
+    pool.parallelFor(8, [&pool, &inner, &onWorker](size_t)
+        {
+            if (!pool.isWorkerThread())
+                onWorker = false;
+            pool.parallelFor(10, [&inner](size_t) { ++inner; });
+        });
+    REQUIRE(onWorker.load());
+    REQUIRE(inner.load() == 80);
+}
+
+TEST_CASE("Population - evaluates on an injected executor", "[ThreadPool][Population]")
+{
+    resetGlobalState();
+    const auto executor = std::make_shared<tools::ThreadPool>(2);
+
+    const PopulationParameters parameters(20, 1, 1.1); // target > 1.0 forces a full run
+    Population population(parameters, std::make_shared<CountingSolution>(makeTopology(1, 1)), false);
+    population.setExecutor(executor);
+    population.initialize();
+    population.evolve();
+
+    REQUIRE(population.getExecutor() == executor);
+    size_t executed = 0;
+    for (const auto& statistics : executor->getWorkerStatistics())
+        executed += statistics.tasksExecuted;
+    REQUIRE(executed > 0);
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include <cmath>
+#include <vector>
 
 #include "neat_tools/utils.h"
 
@@ -205,3 +206,32 @@ TEST_CASE("normalizeWithFlatheadGaussian decreases away from the flat region", "
     REQUIRE(beyond < atEdge);
     REQUIRE(beyond >= 0.0);
 }
+
+TEST_CASE("ScopedEngine routes the calling thread's draws to its engine until it ends", "[engine]")
+{
+    using namespace neat_dnfs::tools::utils;
+
+    Xoshiro256pp first{ streamSeed(42, { 1, 2 }) };
+    Xoshiro256pp second{ streamSeed(42, { 1, 2 }) };
+    std::vector<double> expected;
+    for (int i = 0; i < 5; ++i)
+        expected.push_back(std::uniform_real_distribution<double>(0.0, 1.0)(second));
+
+    const Xoshiro256pp::State outside = engine().getState();
+    {
+        ScopedEngine scope(first);
+        for (const double value : expected)
+            REQUIRE(generateRandomDouble(0.0, 1.0) == value);
+    }
+    REQUIRE(engine().getState() == outside);
+}
+
+TEST_CASE("streamSeed gives every key its own seed", "[engine]")
+{
+    using neat_dnfs::tools::utils::streamSeed;
+
+    REQUIRE(streamSeed(1, { 3, 4 }) == streamSeed(1, { 3, 4 }));
+    REQUIRE(streamSeed(1, { 3, 4 }) != streamSeed(1, { 4, 3 }));
+    REQUIRE(streamSeed(1, { 3, 4 }) != streamSeed(2, { 3, 4 }));
+    REQUIRE(streamSeed(1, { 3 }) != streamSeed(1, { 3, 0 }));
+}